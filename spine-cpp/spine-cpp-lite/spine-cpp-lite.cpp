@@ -31,6 +31,7 @@
 #include <spine/spine.h>
 #include <spine/Version.h>
 #include <spine/Debug.h>
+#include <limits.h>
 
 using namespace spine;
 
@@ -657,6 +658,25 @@ spine_animation_state_events spine_skeleton_drawable_get_animation_state_events(
 	return ((_spine_skeleton_drawable *) drawable)->animationStateEvents;
 }
 
+spine_index_format spine_skeleton_drawable_get_index_format(spine_skeleton_drawable drawable) {
+	_spine_skeleton_drawable *_drawable = (_spine_skeleton_drawable *) drawable;
+	if (!_drawable || !_drawable->renderer) return SPINE_INDEX_FORMAT_UINT16;
+	return (spine_index_format) _drawable->renderer->getIndexFormat();
+}
+
+void spine_skeleton_drawable_set_index_format(spine_skeleton_drawable drawable, spine_index_format format) {
+	_spine_skeleton_drawable *_drawable = (_spine_skeleton_drawable *) drawable;
+	if (!_drawable || !_drawable->renderer) return;
+	_drawable->renderer->setIndexFormat((IndexFormat) format);
+}
+
+void spine_skeleton_drawable_set_max_batch_size(spine_skeleton_drawable drawable, int32_t maxVertices, int32_t maxIndices) {
+	_spine_skeleton_drawable *_drawable = (_spine_skeleton_drawable *) drawable;
+	if (!_drawable || !_drawable->renderer) return;
+	_drawable->renderer->setMaxBatchVertices(maxVertices > 0 ? maxVertices : INT_MAX);
+	_drawable->renderer->setMaxBatchIndices(maxIndices > 0 ? maxIndices : INT_MAX);
+}
+
 // Render command
 float *spine_render_command_get_positions(spine_render_command command) {
 	if (!command) return nullptr;
@@ -688,6 +708,11 @@ uint16_t *spine_render_command_get_indices(spine_render_command command) {
 	return ((RenderCommand *) command)->indices;
 }
 
+uint32_t *spine_render_command_get_indices32(spine_render_command command) {
+	if (!command) return nullptr;
+	return ((RenderCommand *) command)->indices32;
+}
+
 int32_t spine_render_command_get_num_indices(spine_render_command command) {
 	if (!command) return 0;
 	return ((RenderCommand *) command)->numIndices;
@@ -120,6 +120,11 @@ typedef enum spine_blend_mode {
 	SPINE_BLEND_MODE_SCREEN
 } spine_blend_mode;
 
+typedef enum spine_index_format {
+	SPINE_INDEX_FORMAT_UINT16 = 0,
+	SPINE_INDEX_FORMAT_UINT32
+} spine_index_format;
+
 typedef enum spine_mix_blend {
 	SPINE_MIX_BLEND_SETUP = 0,
 	SPINE_MIX_BLEND_FIRST,
@@ -293,6 +298,11 @@ SPINE_CPP_LITE_EXPORT spine_skeleton spine_skeleton_drawable_get_skeleton(spine_
 SPINE_CPP_LITE_EXPORT spine_animation_state spine_skeleton_drawable_get_animation_state(spine_skeleton_drawable drawable);
 SPINE_CPP_LITE_EXPORT spine_animation_state_data spine_skeleton_drawable_get_animation_state_data(spine_skeleton_drawable drawable);
 SPINE_CPP_LITE_EXPORT spine_animation_state_events spine_skeleton_drawable_get_animation_state_events(spine_skeleton_drawable drawable);
+SPINE_CPP_LITE_EXPORT spine_index_format spine_skeleton_drawable_get_index_format(spine_skeleton_drawable drawable);
+SPINE_CPP_LITE_EXPORT void spine_skeleton_drawable_set_index_format(spine_skeleton_drawable drawable, spine_index_format format);
+// The maximum number of vertices and indices of a batch, see SkeletonRenderer::setMaxBatchVertices() and
+// SkeletonRenderer::setMaxBatchIndices(). A value of 0 or less means no limit.
+SPINE_CPP_LITE_EXPORT void spine_skeleton_drawable_set_max_batch_size(spine_skeleton_drawable drawable, int32_t maxVertices, int32_t maxIndices);
 
 // @ignore
 SPINE_CPP_LITE_EXPORT float *spine_render_command_get_positions(spine_render_command command);
@@ -304,6 +314,8 @@ SPINE_CPP_LITE_EXPORT int32_t *spine_render_command_get_colors(spine_render_comm
 SPINE_CPP_LITE_EXPORT int32_t *spine_render_command_get_dark_colors(spine_render_command command);
 SPINE_CPP_LITE_EXPORT int32_t spine_render_command_get_num_vertices(spine_render_command command);
 SPINE_CPP_LITE_EXPORT uint16_t *spine_render_command_get_indices(spine_render_command command);
+// @ignore
+SPINE_CPP_LITE_EXPORT uint32_t *spine_render_command_get_indices32(spine_render_command command);
 SPINE_CPP_LITE_EXPORT int32_t spine_render_command_get_num_indices(spine_render_command command);
 SPINE_CPP_LITE_EXPORT int32_t spine_render_command_get_atlas_page(spine_render_command command);
 SPINE_CPP_LITE_EXPORT spine_blend_mode spine_render_command_get_blend_mode(spine_render_command command);
@@ -96,6 +96,10 @@ namespace spine {
 
 		friend class TwoColorTimeline;
 
+		friend class SkeletonBinary;
+
+		friend class SkeletonJson;
+
 	public:
 		Animation(const String &name, Vector<Timeline *> &timelines, float duration);
 
@@ -116,15 +120,27 @@ namespace spine {
 
 		void setDuration(float inValue);
 
+		/// The index of the animation in SkeletonData::getAnimations(), or -1 if it was not loaded into a skeleton data.
+		int getIndex() { return _index; }
+
+		/// The number of bytes used by the frames and curves of the animation's timelines.
+		size_t getMemorySize();
+
+		/// Returns the index of the last frame at or before the target. Timelines with more than LINEAR_SEARCH_FRAMES frames
+		/// are searched with a binary search, shorter ones with a linear scan.
 		/// @param target After the first and before the last entry.
 		static int search(Vector<float> &values, float target);
 
 		static int search(Vector<float> &values, float target, int step);
+
+		/// The frame count up to which search() scans linearly.
+		static const size_t LINEAR_SEARCH_FRAMES = 16;
 	private:
 		Vector<Timeline *> _timelines;
 		HashMap<PropertyId, bool> _timelineIds;
 		float _duration;
 		String _name;
+		int _index;
 	};
 }
 
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_AnimationBaker_h
+#define Spine_AnimationBaker_h
+
+#include <spine/SpineString.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Animation;
+
+	class AttachmentTimeline;
+
+	class Skeleton;
+
+	class SkeletonData;
+
+	/// An animation sampled at a fixed rate by an AnimationBaker. The bone local transforms, slot colors and slot attachments
+	/// the animation keys are stored as dense tracks, one sample per frame, and apply() interpolates linearly between samples
+	/// without evaluating timelines or curves.
+	class SP_API BakedAnimation : public SpineObject {
+		friend class AnimationBaker;
+
+	public:
+		~BakedAnimation();
+
+		Animation &getAnimation();
+
+		/// The number of samples per second. May be slightly higher than the rate requested from the AnimationBaker so the
+		/// samples are evenly spaced over the animation's duration.
+		float getFrameRate();
+
+		size_t getFrameCount();
+
+		/// Sets the baked bone local transforms, slot colors and attachments for the specified time. Inactive bones and
+		/// slots are skipped.
+		/// @param time The animation time, which is wrapped to the animation's duration if loop is true and clamped to it
+		/// otherwise.
+		/// @param alpha Interpolates between the current pose (0) and the baked pose (1). Attachments are set from the sample at
+		/// or before the time, regardless of alpha.
+		void apply(Skeleton &skeleton, float time, bool loop, float alpha);
+
+		/// The number of bytes used by the baked tracks.
+		size_t getMemorySize();
+
+		/// The number of the animation's timelines which were not baked and are ignored by apply(), such as deform, draw
+		/// order, event, sequence, inherit and constraint timelines.
+		int getUnbakedTimelineCount();
+
+		/// The largest difference between the interpolated samples and the animation's timelines, measured between samples
+		/// when the animation was baked.
+		float getMaxTranslationError();
+
+		/// @see getMaxTranslationError(). In degrees.
+		float getMaxRotationError();
+
+		/// @see getMaxTranslationError()
+		float getMaxScaleError();
+
+		/// @see getMaxTranslationError(). In degrees.
+		float getMaxShearError();
+
+		/// @see getMaxTranslationError(). For color components between 0 and 1.
+		float getMaxColorError();
+
+	private:
+		enum Channel {
+			Channel_Rotate,
+			Channel_X,
+			Channel_Y,
+			Channel_ScaleX,
+			Channel_ScaleY,
+			Channel_ShearX,
+			Channel_ShearY,
+			Channel_R,
+			Channel_G,
+			Channel_B,
+			Channel_A,
+			Channel_DarkR,
+			Channel_DarkG,
+			Channel_DarkB
+		};
+
+		BakedAnimation(Animation &animation);
+
+		float &getChannelValue(Skeleton &skeleton, size_t channel);
+
+		Animation &_animation;
+		float _frameRate;
+		size_t _frameCount;
+		float _duration;
+		Vector<int> _channels;
+		Vector<int> _channelIndices;
+		/// Frame major, _channels.size() values per frame.
+		Vector<float> _values;
+		Vector<int> _attachmentSlots;
+		/// Frame major, _attachmentSlots.size() names per frame. NULL for no attachment.
+		Vector<const String *> _attachmentNames;
+		int _unbakedTimelineCount;
+		float _maxErrors[Channel_DarkB + 1];
+	};
+
+	/// Samples animations of a skeleton at a fixed rate into BakedAnimations, for playing many skeletons where exact curve
+	/// evaluation is not needed.
+	class SP_API AnimationBaker : public SpineObject {
+	public:
+		explicit AnimationBaker(SkeletonData &skeletonData);
+
+		~AnimationBaker();
+
+		/// Samples the animation at the specified rate. The animation and the SkeletonData must outlive the returned
+		/// BakedAnimation, which references them.
+		/// @param frameRate The number of samples per second.
+		/// @return The baked animation, owned by the caller.
+		BakedAnimation *bake(Animation &animation, float frameRate);
+
+	private:
+		Skeleton *_skeleton;
+
+		/// Poses the skeleton with the animation alone at the specified time.
+		void pose(Animation &animation, float time);
+
+		const String *getAttachmentName(AttachmentTimeline &timeline, float time);
+	};
+}
+
+#endif /* Spine_AnimationBaker_h */
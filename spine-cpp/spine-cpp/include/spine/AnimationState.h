@@ -69,6 +69,16 @@ namespace spine {
 
 	class AttachmentTimeline;
 
+	class Timeline;
+
+	class TrackMask;
+
+	class SnapshotWriter;
+
+	class SnapshotReader;
+
+	class SnapshotValidator;
+
 #ifdef SPINE_USE_STD_FUNCTION
 	typedef std::function<void (AnimationState* state, EventType type, TrackEntry* entry, Event* event)> AnimationStateListener;
 #else
@@ -256,6 +266,14 @@ namespace spine {
 
 		void setMixBlend(MixBlend blend);
 
+		/// The bone and slot weights the animation is applied with, or NULL to apply all of the animation's timelines fully.
+		/// Timelines of masked out bones and slots are dropped when the tracks change and the weights of the current entry's
+		/// mask are checked each time the state is applied. Changes to the mask of an entry that is mixing out take effect
+		/// the next time the tracks change.
+		TrackMask *getMask();
+
+		void setMask(TrackMask *mask);
+
 		/// The track entry for the previous animation when mixing from the previous animation to this animation, or NULL if no
 		/// mixing is currently occuring. When mixing from multiple animations, MixingFrom makes up a double linked list with MixingTo.
 		TrackEntry *getMixingFrom();
@@ -307,6 +325,26 @@ namespace spine {
 		Vector<int> _timelineMode;
 		Vector<TrackEntry *> _timelineHoldMix;
 		Vector<float> _timelinesRotation;
+
+		TrackMask *_mask;
+		int _maskVersion;
+
+		/// A timeline of the animation with how AnimationState applies it, see AnimationState::buildTimelinePlan().
+		struct TimelinePlan {
+			Timeline *timeline;
+			int kind;
+			int mode;
+			TrackEntry *holdMix;
+			float weight;
+			size_t index;
+		};
+
+		Vector<TimelinePlan> _timelinePlan;
+
+		/// The plan without the timelines higher tracks fully override, used while all _overrideEntries are overriding.
+		Vector<TimelinePlan> _overridePlan;
+		Vector<TrackEntry *> _overrideEntries;
+		bool _overriding, _overridden;
 		AnimationStateListener _listener;
 		AnimationStateListenerObject *_listenerObject;
 
@@ -453,6 +491,23 @@ namespace spine {
 
 		void disposeTrackEntry(TrackEntry *entry);
 
+		/// Returns the number of bytes writeSnapshot() needs for the current state.
+		size_t getSnapshotSize();
+
+		/// Writes the state of all tracks and their queued and mixing track entries to a flat buffer. Must be called between
+		/// updates. The snapshot references animations and listeners by pointer, so it can only be read by an animation state
+		/// of the same AnimationStateData in the same process. Track entry renderer objects are not stored, and listeners are
+		/// not stored if SPINE_USE_STD_FUNCTION is defined.
+		/// @return The number of bytes written, or 0 if size is smaller than getSnapshotSize().
+		size_t writeSnapshot(void *buffer, size_t size);
+
+		/// Restores the state written by writeSnapshot(). The current track entries are returned to the pool without firing
+		/// events, so TrackEntry pointers obtained before the call must not be used after it. Track entries are obtained from
+		/// the pool, so this does not allocate once the pool holds enough entries.
+		/// @return False if the buffer does not hold a snapshot of an animation state of the same AnimationStateData. The
+		/// animation state is unchanged in that case.
+		bool readSnapshot(const void *buffer, size_t size);
+
 	private:
 		static const int Subsequent = 0;
 		static const int First = 1;
@@ -463,6 +518,12 @@ namespace spine {
 		static const int Setup = 1;
 		static const int Current = 2;
 
+		static const int Kind_Timeline = 0;
+		static const int Kind_Rotate = 1;
+		static const int Kind_Attachment = 2;
+		static const int Kind_DrawOrder = 3;
+		static const int Kind_Curve = 4;
+
 		AnimationStateData *_data;
 
 		Pool<TrackEntry> _trackEntryPool;
@@ -471,6 +532,7 @@ namespace spine {
 		EventQueue *_queue;
 
 		HashMap<PropertyId, bool> _propertyIDs;
+		HashMap<PropertyId, TrackEntry *> _overrideIds;
 		bool _animationsChanged;
 
 		AnimationStateListener _listener;
@@ -482,6 +544,11 @@ namespace spine {
 
 		bool _manualTrackEntryDisposal;
 
+		Vector<TrackEntry *> _snapshotEntries;
+
+		/// The most timelines of any animation, the capacity of the per timeline data of track entries.
+		size_t _timelineCapacity;
+
 		static Animation *getEmptyAnimation();
 
 		static void
@@ -514,7 +581,46 @@ namespace spine {
 
 		void computeHold(TrackEntry *entry);
 
+		/// Stores each timeline of the entry with its kind and the mode computeHold() computed for it, so apply() needs no
+		/// RTTI checks.
+		void buildTimelinePlan(TrackEntry *entry);
+
+		/// Computes the override plans of the current entries, from the highest track to the lowest.
+		void computeOverrides();
+
+		/// Builds the entry's override plan from the properties in _overrideIds, then adds the properties the entry fully
+		/// overrides while it is applied alone with an alpha of 1.
+		void computeOverrides(TrackEntry *entry);
+
 		void setAttachment(Skeleton &skeleton, spine::Slot &slot, const String &attachmentName, bool attachments);
+
+		/// Collects the track entries reachable from the tracks in _snapshotEntries.
+		void collectSnapshotEntries();
+
+		template<typename T>
+		void snapshot(T &archive);
+
+		/// Checks the snapshot's layout using a scratch track entry, without changing the animation state.
+		void snapshot(SnapshotValidator &validator);
+
+		template<typename T>
+		void snapshotEntry(T &archive, TrackEntry &entry);
+
+		void snapshotEntries(SnapshotWriter &writer);
+
+		void snapshotEntries(SnapshotReader &reader);
+
+		void snapshotLink(SnapshotWriter &writer, TrackEntry *&entry);
+
+		void snapshotLink(SnapshotReader &reader, TrackEntry *&entry);
+
+		void snapshotLink(SnapshotValidator &validator, TrackEntry *&entry);
+
+		void snapshotLinks(SnapshotWriter &writer, Vector<TrackEntry *> &entries);
+
+		void snapshotLinks(SnapshotReader &reader, Vector<TrackEntry *> &entries);
+
+		void snapshotLinks(SnapshotValidator &validator, Vector<TrackEntry *> &entries);
 	};
 }
 
@@ -70,6 +70,13 @@ namespace spine {
 		/// Removes all mixes and sets the default mix to 0.
 		void clear();
 
+		/// When true, the mix durations between animations of the skeleton data are also stored in a matrix indexed by
+		/// Animation::getIndex(), so getMix() needs no hash lookup for them. The matrix uses 4 bytes for each pair of the
+		/// skeleton data's animations. Default is false.
+		void setMixMatrixEnabled(bool enabled);
+
+		bool isMixMatrixEnabled();
+
 	private:
 		class AnimationPair : public SpineObject {
 		public:
@@ -79,11 +86,21 @@ namespace spine {
 			explicit AnimationPair(Animation *a1 = NULL, Animation *a2 = NULL);
 
 			bool operator==(const AnimationPair &other) const;
+
+			size_t hash() const;
 		};
 
 		SkeletonData *_skeletonData;
 		float _defaultMix;
 		HashMap<AnimationPair, float> _animationToMixTime;
+		bool _mixMatrixEnabled;
+		size_t _mixMatrixSize;
+		Vector<float> _mixMatrix;
+
+		/// Returns the matrix index of the animation, or -1 if the animation is not in the matrix.
+		int getMatrixIndex(Animation *animation);
+
+		void setMatrixMix(Animation *from, Animation *to, float duration);
 	};
 }
 
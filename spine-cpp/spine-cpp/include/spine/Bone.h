@@ -46,8 +46,12 @@ namespace spine {
 /// local transform that can be applied to compute the world transform. The local transform and applied transform may differ if a
 /// constraint or application code modifies the world transform after it was computed from the local transform.
 	class SP_API Bone : public Updatable {
+		friend class AnimationBaker;
+
 		friend class AnimationState;
 
+		friend class BakedAnimation;
+
 		friend class RotateTimeline;
 
 		friend class IkConstraint;
@@ -56,12 +60,16 @@ namespace spine {
 
 		friend class VertexAttachment;
 
+		friend class VertexSkinning;
+
 		friend class PathConstraint;
 
         friend class PhysicsConstraint;
 
 		friend class Skeleton;
 
+		friend class SkeletonWorldInstance;
+
 		friend class RegionAttachment;
 
 		friend class PointAttachment;
@@ -264,7 +272,10 @@ namespace spine {
 
         Inherit getInherit() { return _inherit; }
 
-        void setInherit(Inherit inValue) { _inherit = inValue; }
+        void setInherit(Inherit inValue) {
+            _inherit = inValue;
+            _modified = true;
+        }
 
 	private:
 		static bool yDown;
@@ -279,6 +290,9 @@ namespace spine {
 		float _c, _d, _worldY;
 		bool _sorted;
 		bool _active;
+		bool _modified;
+		bool _constrained;
+		bool _recomputed;
         Inherit _inherit;
 	};
 }
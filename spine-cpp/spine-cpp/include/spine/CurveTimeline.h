@@ -53,8 +53,14 @@ namespace spine {
 
 		float getBezierValue(float time, size_t frame, size_t valueOffset, size_t i);
 
+		/// Evaluates the beziers of count consecutive values, the first at value offset 1 and curve index i. Faster than
+		/// calling getBezierValue() for each value when the curves share their time control points.
+		void getBezierValues(float time, size_t frame, size_t i, float *values, size_t count);
+
 		Vector<float> &getCurves();
 
+		virtual size_t getMemorySize();
+
 	protected:
 		static const int LINEAR = 0;
 		static const int STEPPED = 1;
@@ -62,6 +68,25 @@ namespace spine {
 		static const int BEZIER_SIZE = 18;
 
 		Vector<float> _curves; // type, x, y, ...
+
+		/// Builds the lookup getBezierSegment() uses, after the samples of the bezier were set.
+		void setBezierLookup(size_t bezier, float time1, float time2);
+
+		/// Returns the segment of the samples at curve index i the time is in: 0 before the first sample, 1-8 between two
+		/// samples and 9 after the last sample.
+		size_t getBezierSegment(size_t i, float time);
+
+		/// Frees the bezier lookup, eg when the curves were replaced.
+		void clearBezierLookup();
+
+	private:
+		float getBezierSegmentValue(float time, size_t frame, size_t valueOffset, size_t i, size_t segment);
+
+		size_t _bezierStart;
+		/// The time of each bezier's first frame and the scale from a time to a lookup bucket.
+		Vector<float> _bezierTimes;
+		/// For each bezier, the first segment that can hold a time of each of a fixed number of equal time buckets.
+		Vector<unsigned char> _bezierSegments;
 	};
 
 	class SP_API CurveTimeline1 : public CurveTimeline {
@@ -84,9 +109,29 @@ namespace spine {
 
         float getScaleValue (float time, float alpha, MixBlend blend, MixDirection direction, float current, float setup);
 
+		/// Replaces the frame values with 16-bit values quantized over the timeline's value range, and the samples of each
+		/// bezier with its 16-bit control points, which are expanded when a curve value is computed. Frame times are kept as
+		/// floats. Afterward getFrames() holds only the frame times and getCurves() only the curve type of each frame, and the
+		/// frames must not be set.
+		/// @param tolerance The largest allowed difference between the quantized and the original curve values.
+		/// @return False if the timeline was left unchanged because the difference would exceed the tolerance.
+		bool quantize(float tolerance);
+
+		bool isQuantized();
+
+		virtual size_t getMemorySize();
+
 	protected:
 		static const int ENTRIES = 2;
 		static const int VALUE = 1;
+
+	private:
+		/// The value of each frame, then the cx1, cy1, cx2, cy2 control points of each bezier.
+		Vector<unsigned short> _quantized;
+		float _quantizedOffset, _quantizedScale;
+
+		static float getQuantizedValue(float time, Vector<float> &times, Vector<float> &curves,
+									   Vector<unsigned short> &quantized, float offset, float scale);
 	};
 
 	class SP_API CurveTimeline2 : public CurveTimeline {
@@ -34,6 +34,7 @@
 #include <spine/Vector.h>
 
 #include <map>
+#include <stdlib.h>
 
 namespace spine {
 
@@ -53,7 +54,8 @@ namespace spine {
 
 	public:
 		DebugExtension(SpineExtension *extension) : _extension(extension), _allocations(0), _reallocations(0),
-													_frees(0) {
+													_frees(0), _usedMemory(0), _allocationsAllowed(true),
+													_abortOnDisallowedAllocation(false), _disallowedAllocations(0) {
 		}
 
 		void reportLeaks() {
@@ -70,7 +72,25 @@ namespace spine {
 			_usedMemory = 0;
 		}
 
+		/// When false, each allocation or reallocation is reported and counted. Used to check that code like animation
+		/// switching does not allocate once warmed up. Default is true.
+		void setAllocationsAllowed(bool allowed) {
+			_allocationsAllowed = allowed;
+		}
+
+		/// When true, an allocation or reallocation while allocations are not allowed aborts after it is reported, eg to stop
+		/// in a debugger at the allocation. Default is false.
+		void setAbortOnDisallowedAllocation(bool abortOnDisallowedAllocation) {
+			_abortOnDisallowedAllocation = abortOnDisallowedAllocation;
+		}
+
+		/// The number of allocations and reallocations while allocations were not allowed.
+		size_t getDisallowedAllocations() {
+			return _disallowedAllocations;
+		}
+
 		virtual void *_alloc(size_t size, const char *file, int line) {
+			checkAllocation(file, line);
 			void *result = _extension->_alloc(size, file, line);
 			_allocated[result] = Allocation(result, size, file, line);
 			_allocations++;
@@ -79,6 +99,7 @@ namespace spine {
 		}
 
 		virtual void *_calloc(size_t size, const char *file, int line) {
+			checkAllocation(file, line);
 			void *result = _extension->_calloc(size, file, line);
 			_allocated[result] = Allocation(result, size, file, line);
 			_allocations++;
@@ -87,6 +108,7 @@ namespace spine {
 		}
 
 		virtual void *_realloc(void *ptr, size_t size, const char *file, int line) {
+			checkAllocation(file, line);
 			if (_allocated.count(ptr)) _usedMemory -= _allocated[ptr].size;
 			_allocated.erase(ptr);
 			void *result = _extension->_realloc(ptr, size, file, line);
@@ -126,12 +148,22 @@ namespace spine {
 		}
 
 	private:
+		void checkAllocation(const char *file, int line) {
+			if (_allocationsAllowed) return;
+			_disallowedAllocations++;
+			printf("%s:%i: Allocation while allocations are not allowed\n", file, line);
+			if (_abortOnDisallowedAllocation) abort();
+		}
+
 		SpineExtension *_extension;
 		std::map<void *, Allocation> _allocated;
 		size_t _allocations;
 		size_t _reallocations;
 		size_t _frees;
 		size_t _usedMemory;
+		bool _allocationsAllowed;
+		bool _abortOnDisallowedAllocation;
+		size_t _disallowedAllocations;
 	};
 }
 
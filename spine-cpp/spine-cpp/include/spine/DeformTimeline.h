@@ -49,10 +49,23 @@ namespace spine {
 		apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha, MixBlend blend,
 			  MixDirection direction);
 
-		/// Sets the time and value of the specified keyframe.
-		void setFrame(int frameIndex, float time, Vector<float> &vertices);
+		/// Sets the time and vertices of the specified keyframe. The vertices are stored as the deltas from the attachment's
+		/// setup vertices (unweighted) or as the deform offsets (weighted), without the leading and trailing zeros.
+		void setFrame(int frame, float time, Vector<float> &vertices);
 
-		Vector <Vector<float>> &getVertices();
+		/// Sets the time and deltas of the specified keyframe, starting at the specified vertex float. The deltas are
+		/// offsets from the attachment's setup vertices (unweighted) or the deform offsets (weighted). Floats outside
+		/// the deltas are 0, so a frame without deltas does not store any.
+		void setFrame(int frame, float time, Vector<float> &deltas, int offset);
+
+		/// The deltas of each frame, see setFrame().
+		Vector <Vector<float>> &getDeltas();
+
+		/// The first vertex float of each frame's deltas.
+		Vector<int> &getOffsets();
+
+		/// The number of floats in the attachment's deform.
+		size_t getVertexCount() { return _vertexCount; }
 
 		VertexAttachment *getAttachment();
 
@@ -68,10 +81,16 @@ namespace spine {
 
 		void setSlotIndex(int inValue) { _slotIndex = inValue; }
 
+		virtual size_t getMemorySize();
+
 	protected:
 		int _slotIndex;
 
-		Vector <Vector<float>> _vertices;
+		Vector <Vector<float>> _deltas;
+
+		Vector<int> _offsets;
+
+		size_t _vertexCount;
 
 		VertexAttachment *_attachment;
 	};
@@ -33,6 +33,8 @@
 #include <spine/Vector.h>
 #include <spine/SpineObject.h>
 
+#include <stdint.h>
+
 // Required for new with line number and file name in MSVC
 #ifdef _MSC_VER
 #pragma warning(disable:4291)
@@ -42,6 +44,42 @@
 #endif
 
 namespace spine {
+	/// Hashes the keys of a HashMap. Integer and pointer keys are hashed directly, other key types must provide a
+	/// size_t hash() const method that is consistent with their operator==. The hash is 64-bit so 64-bit keys keep their
+	/// high bits on 32-bit targets until they are mixed.
+	template<typename K>
+	struct HashMapHash {
+		static uint64_t hash(const K &key) {
+			return (uint64_t) key.hash();
+		}
+	};
+
+	template<typename K>
+	struct HashMapHash<K *> {
+		static uint64_t hash(K *key) {
+			return (uint64_t) (uintptr_t) key;
+		}
+	};
+
+#define SPINE_HASHMAP_INTEGER_HASH(K) \
+	template<> \
+	struct HashMapHash<K> { \
+		static uint64_t hash(K key) { \
+			return (uint64_t) key; \
+		} \
+	};
+
+	SPINE_HASHMAP_INTEGER_HASH(int)
+	SPINE_HASHMAP_INTEGER_HASH(unsigned int)
+	SPINE_HASHMAP_INTEGER_HASH(long)
+	SPINE_HASHMAP_INTEGER_HASH(unsigned long)
+	SPINE_HASHMAP_INTEGER_HASH(long long)
+	SPINE_HASHMAP_INTEGER_HASH(unsigned long long)
+
+#undef SPINE_HASHMAP_INTEGER_HASH
+
+	/// An open addressing hash map with linear probing. The entries are stored inline in a power of two sized table, so
+	/// put() only allocates when the table grows, and clear() keeps the table for reuse.
 	template<typename K, typename V>
 	class SP_API HashMap : public SpineObject {
 	private:
@@ -60,47 +98,50 @@ namespace spine {
 		public:
 			friend class HashMap;
 
-			explicit Entries(Entry *entry) : _entry(NULL), _hasChecked(false) {
-				_start.next = entry;
-				_entry = &_start;
+			explicit Entries(Entry *entries, size_t capacity) : _entries(entries), _capacity(capacity), _index(0),
+																 _hasChecked(false) {
 			}
 
 			Pair next() {
-				assert(_entry);
 				assert(_hasChecked);
-				_entry = _entry->next;
-				Pair pair(_entry->_key, _entry->_value);
+				assert(_index < _capacity);
+				Entry &entry = _entries[_index++];
 				_hasChecked = false;
-				return pair;
+				return Pair(entry._key, entry._value);
 			}
 
 			bool hasNext() {
 				_hasChecked = true;
-				return _entry->next;
+				while (_index < _capacity && !_entries[_index]._used)
+					_index++;
+				return _index < _capacity;
 			}
 
 		private:
+			Entry *_entries;
+			size_t _capacity;
+			size_t _index;
 			bool _hasChecked;
-			Entry _start;
-			Entry *_entry;
 		};
 
 		HashMap() :
-				_head(NULL),
+				_entries(NULL),
+				_capacity(0),
 				_size(0) {
 		}
 
 		~HashMap() {
 			clear();
+			if (_entries) SpineExtension::free(_entries, __FILE__, __LINE__);
 		}
 
+		/// Removes all entries. The table is kept, so refilling the map does not allocate.
 		void clear() {
-			for (Entry *entry = _head; entry != NULL;) {
-				Entry *next = entry->next;
-				delete entry;
-				entry = next;
+			if (_size == 0) return;
+			for (size_t i = 0; i < _capacity; i++) {
+				Entry &entry = _entries[i];
+				if (entry._used) destroy(entry);
 			}
-			_head = NULL;
 			_size = 0;
 		}
 
@@ -109,25 +150,22 @@ namespace spine {
 		}
 
 		void put(const K &key, const V &value) {
-			Entry *entry = find(key);
-			if (entry) {
-				entry->_key = key;
-				entry->_value = value;
-			} else {
-				entry = new(__FILE__, __LINE__) Entry();
-				entry->_key = key;
-				entry->_value = value;
-
-				Entry *oldHead = _head;
-
-				if (oldHead) {
-					_head = entry;
-					oldHead->prev = entry;
-					entry->next = oldHead;
-				} else {
-					_head = entry;
+			if ((_size + 1) << 2 > _capacity * 3) grow();
+			size_t mask = _capacity - 1;
+			for (size_t i = hash(key) & mask;; i = (i + 1) & mask) {
+				Entry &entry = _entries[i];
+				if (!entry._used) {
+					new (&entry._key) K(key);
+					new (&entry._value) V(value);
+					entry._used = true;
+					_size++;
+					return;
+				}
+				if (entry._key == key) {
+					entry._key = key;
+					entry._value = value;
+					return;
 				}
-				_size++;
 			}
 		}
 
@@ -147,16 +185,16 @@ namespace spine {
 			Entry *entry = find(key);
 			if (!entry) return false;
 
-			Entry *prev = entry->prev;
-			Entry *next = entry->next;
-
-			if (prev) prev->next = next;
-			else _head = next;
-			if (next) next->prev = entry->prev;
-
-			delete entry;
+			// Shift the following entries of the probe sequence back so lookups need no tombstones.
+			size_t mask = _capacity - 1, hole = entry - _entries;
+			destroy(*entry);
 			_size--;
-
+			for (size_t i = (hole + 1) & mask; _entries[i]._used; i = (i + 1) & mask) {
+				size_t home = hash(_entries[i]._key) & mask;
+				if (((i - home) & mask) < ((i - hole) & mask)) continue;
+				move(_entries[i], _entries[hole]);
+				hole = i;
+			}
 			return true;
 		}
 
@@ -169,30 +207,78 @@ namespace spine {
 			}
 		}
 
+		/// Returns the value for the key, or the default value if the map does not contain the key.
+		V get(const K &key, const V &defaultValue) {
+			Entry *entry = find(key);
+			return entry ? entry->_value : defaultValue;
+		}
+
 		Entries getEntries() const {
-			return Entries(_head);
+			return Entries(_entries, _capacity);
 		}
 
 	private:
+		static size_t hash(const K &key) {
+			// Mixes the bits so keys differing only in their high bits, like PropertyIds, use different buckets.
+			uint64_t h = HashMapHash<K>::hash(key);
+			h ^= h >> 33;
+			h *= 0xff51afd7ed558ccdULL;
+			h ^= h >> 33;
+			h *= 0xc4ceb9fe1a85ec53ULL;
+			h ^= h >> 33;
+			return (size_t) h;
+		}
+
 		Entry *find(const K &key) {
-			for (Entry *entry = _head; entry != NULL; entry = entry->next) {
-				if (entry->_key == key)
-					return entry;
+			if (_size == 0) return NULL;
+			size_t mask = _capacity - 1;
+			for (size_t i = hash(key) & mask;; i = (i + 1) & mask) {
+				Entry &entry = _entries[i];
+				if (!entry._used) return NULL;
+				if (entry._key == key) return &entry;
 			}
-			return NULL;
 		}
 
-		class SP_API Entry : public SpineObject {
+		void grow() {
+			Entry *oldEntries = _entries;
+			size_t oldCapacity = _capacity;
+			_capacity = _capacity == 0 ? 8 : _capacity << 1;
+			_entries = SpineExtension::calloc<Entry>(_capacity, __FILE__, __LINE__);
+			size_t mask = _capacity - 1;
+			for (size_t i = 0; i < oldCapacity; i++) {
+				Entry &entry = oldEntries[i];
+				if (!entry._used) continue;
+				size_t ii = hash(entry._key) & mask;
+				while (_entries[ii]._used)
+					ii = (ii + 1) & mask;
+				move(entry, _entries[ii]);
+			}
+			if (oldEntries) SpineExtension::free(oldEntries, __FILE__, __LINE__);
+		}
+
+		static void destroy(Entry &entry) {
+			entry._key.~K();
+			entry._value.~V();
+			entry._used = false;
+		}
+
+		static void move(Entry &from, Entry &to) {
+			new (&to._key) K(from._key);
+			new (&to._value) V(from._value);
+			to._used = true;
+			destroy(from);
+		}
+
+		/// The key and value are constructed in place when the entry is used, the table memory is zeroed.
+		class SP_API Entry {
 		public:
 			K _key;
 			V _value;
-			Entry *next;
-			Entry *prev;
-
-			Entry() : next(NULL), prev(NULL) {}
+			bool _used;
 		};
 
-		Entry *_head;
+		Entry *_entries;
+		size_t _capacity;
 		size_t _size;
 	};
 }
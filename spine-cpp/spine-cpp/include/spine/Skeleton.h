@@ -60,13 +60,19 @@ namespace spine {
 
     class SkeletonClipping;
 
+	class UpdateCacheProgram;
+
 	class SP_API Skeleton : public SpineObject {
 		friend class AnimationState;
 
+		friend class Bone;
+
 		friend class SkeletonBounds;
 
 		friend class SkeletonClipping;
 
+		friend class SkeletonWorldInstance;
+
 		friend class AttachmentTimeline;
 
 		friend class RGBATimeline;
@@ -124,6 +130,10 @@ namespace spine {
 
 		/// Caches information about bones and constraints. Must be called if bones, constraints or weighted path attachments are added
 		/// or removed.
+		///
+		/// For no skin or a skin of the SkeletonData, the result is cached on the SkeletonData as an UpdateCacheProgram and reused
+		/// by other skeletons, see SkeletonData::clearUpdateCachePrograms(). Creating the program modifies the SkeletonData, so
+		/// skeletons sharing a SkeletonData must not update their caches concurrently.
 		void updateCache();
 
 		void printUpdateCache();
@@ -136,6 +146,20 @@ namespace spine {
 
 		void updateWorldTransform(Physics physics, Bone *parent);
 
+		/// If true, updateWorldTransform(Physics) keeps the world transform of a bone instead of recomputing it when the bone's
+		/// transform was not set since the previous update, no constraint with a nonzero mix modifies it and its parent's world
+		/// transform was kept too. Timelines, setToSetupPose() and the Bone setters mark the bones they set. Changing the
+		/// skeleton position, scale or update cache recomputes all bones on the next update. Defaults to false.
+		void setIncremental(bool incremental);
+
+		bool isIncremental();
+
+		/// The number of bones the last updateWorldTransform(Physics) recomputed.
+		int getRecomputedBoneCount();
+
+		/// The number of bones the last updateWorldTransform(Physics) kept because of setIncremental().
+		int getSkippedBoneCount();
+
 		/// Sets the bones, constraints, and slots to their setup pose values.
 		void setToSetupPose();
 
@@ -248,6 +272,21 @@ namespace spine {
         /// Calls {@link PhysicsConstraint#rotate(float, float, float)} for each physics constraint. */
         void physicsRotate(float x, float y, float degrees);
 
+		/// Returns the number of bytes writeSnapshot() needs for the skeleton's current state.
+		size_t getSnapshotSize();
+
+		/// Writes the skeleton's simulation state to a flat buffer: the skin, bone local, applied and world transforms, slot
+		/// colors, attachments and deform, the draw order, constraint mixes and physics state. The snapshot references
+		/// attachments and skins by pointer, so it can only be read by a skeleton of the same SkeletonData in the same process.
+		/// @return The number of bytes written, or 0 if size is smaller than getSnapshotSize().
+		size_t writeSnapshot(void *buffer, size_t size);
+
+		/// Restores the state written by writeSnapshot(). Does not allocate unless a slot's deform grows beyond its capacity or
+		/// the skin changes, which rebuilds the update cache.
+		/// @return False if the buffer does not hold a snapshot of a skeleton of the same SkeletonData. The skeleton is
+		/// unchanged in that case.
+		bool readSnapshot(const void *buffer, size_t size);
+
 	private:
 		SkeletonData *_data;
 		Vector<Bone *> _bones;
@@ -263,6 +302,18 @@ namespace spine {
 		float _scaleX, _scaleY;
 		float _x, _y;
         float _time;
+		bool _incremental, _incrementalUpdate, _worldInvalid;
+		int _recomputedBones, _skippedBones;
+		char *_arena;
+		size_t _arenaLength;
+
+		void sortUpdateCache();
+
+		void markConstrainedBones();
+
+		bool bindUpdateCache(UpdateCacheProgram &program);
+
+		UpdateCacheProgram *createUpdateCacheProgram();
 
 		void sortIkConstraint(IkConstraint *constraint);
 
@@ -279,6 +330,9 @@ namespace spine {
 		void sortBone(Bone *bone);
 
 		static void sortReset(Vector<Bone *> &bones);
+
+		template<typename T>
+		void snapshot(T &archive);
 	};
 }
 
@@ -116,6 +116,10 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// If greater than 0, CurveTimeline1 timelines are quantized with CurveTimeline1::quantize() using this tolerance as
+		/// animations are read. Defaults to 0.
+		void setQuantizationTolerance(float tolerance) { _quantizationTolerance = tolerance; }
+
 		String &getError() { return _error; }
 
 	private:
@@ -128,6 +132,7 @@ namespace spine {
 		Vector<LinkedMesh *> _linkedMeshes;
 		String _error;
 		float _scale;
+		float _quantizationTolerance;
 		const bool _ownsLoader;
 
 		void setError(const char *value1, const char *value2);
@@ -32,6 +32,8 @@
 
 #include <spine/Vector.h>
 #include <spine/Triangulator.h>
+#include <spine/HashMap.h>
+#include <spine/Pool.h>
 
 namespace spine {
 	class Slot;
@@ -42,6 +44,8 @@ namespace spine {
 	public:
 		SkeletonClipping();
 
+		~SkeletonClipping();
+
 		size_t clipStart(Slot &slot, ClippingAttachment *clip);
 
 		void clipEnd(Slot &slot);
@@ -65,7 +69,66 @@ namespace spine {
 
 		Vector<float> &getClippedUVs();
 
+		/// The number of triangles passed through unchanged because they were inside the clipping area, without clipping.
+		size_t getAcceptedCount();
+
+		/// The number of triangles dropped because their bounds did not overlap the clipping area.
+		size_t getRejectedCount();
+
+		/// The number of triangles that were clipped against the clipping area's polygons.
+		size_t getClippedCount();
+
+		/// Sets the accepted, rejected and clipped counts to 0.
+		void resetCounts();
+
+		bool getShareVertices();
+
+		/// If true, clipTriangles() outputs each vertex once: triangles that are not clipped use the input mesh's vertices
+		/// and vertices generated where a triangle edge crosses a clipping edge are shared by the triangles on both sides of
+		/// the edge. UVs are only computed for generated vertices. Default is false, where each triangle fan of the output
+		/// has its own vertices.
+		void setShareVertices(bool shareVertices);
+
+		/// Disposes the convex decompositions cached for unweighted clipping attachments, eg to free their memory after
+		/// disposing a SkeletonData or skin rendered with a long lived SkeletonRenderer. Entries are checked against the
+		/// attachment's current vertices, so an entry left for a disposed attachment is never used wrongly. Must not be
+		/// called between clipStart() and clipEnd().
+		void clearCache();
+
+		size_t getMaxCacheSize();
+
+		/// The most clipping attachments the cache holds decompositions for. When a clipping attachment that is not cached
+		/// is clipped with while the cache is full, the cache is cleared first, so memory stays bounded when clipping
+		/// attachments are created and disposed while the clipper is kept. 0 disables the cache. Default is 256.
+		void setMaxCacheSize(size_t maxCacheSize);
+
 	private:
+		/// The convex decomposition of an unweighted clipping attachment, built from its local vertices. The decomposition is
+		/// unchanged by the bone's affine transform, so while the local vertices stay the same only the vertex transform is
+		/// done per frame.
+		class ClippingCache : public SpineObject {
+		public:
+			Vector<float> vertices;
+			Vector<int> offsets;
+			Vector<int> counts;
+		};
+
+		/// A vertex of the polygon clipped in shared vertex mode, see clipShared().
+		struct ClipVertex {
+			float x, y;
+			/// Identifies the output vertex: an input vertex, where a triangle edge crosses a clipping edge, or where a
+			/// clipping edge crosses another inside one triangle.
+			uint64_t key;
+			/// The line the edge to the next vertex lies on: clipping edge line if >= 0, else triangle edge -line - 1.
+			int line;
+		};
+
+		/// The values to interpolate UVs of generated vertices inside the triangle being clipped.
+		struct TriangleUVs {
+			float x3, y3, d0, d1, d2, d4, d;
+			float u1, v1, u2, v2, u3, v3;
+		};
+
 		Triangulator _triangulator;
 		Vector<float> _clippingPolygon;
 		Vector<float> _clipOutput;
@@ -75,6 +138,40 @@ namespace spine {
 		Vector<float> _scratch;
 		ClippingAttachment *_clipAttachment;
 		Vector<Vector<float> *> *_clippingPolygons;
+		HashMap<ClippingAttachment *, ClippingCache *> _caches;
+		size_t _maxCacheSize;
+		Pool<Vector<float> > _polygonPool;
+		Vector<Vector<float> *> _cachedPolygons;
+		/// The bounds of each clipping polygon, as min x, min y, max x, max y, and of the whole clipping area.
+		Vector<float> _clippingBounds;
+		float _minX, _minY, _maxX, _maxY;
+		/// True if the clipping area is a single axis aligned rectangle, so containment is a bounds test.
+		bool _rectangle;
+		size_t _acceptedCount, _rejectedCount, _clippedCount;
+		/// The index of the first edge of each clipping polygon, counting the edges of all polygons.
+		Vector<int> _clippingEdges;
+		bool _shareVertices;
+		Vector<ClipVertex> _sharedInput, _sharedOutput;
+		/// The output vertex of each input vertex, or -1.
+		Vector<int> _vertexIds;
+		/// The output vertex of each generated vertex key.
+		HashMap<uint64_t, int> _edgeVertices;
+		Vector<unsigned short> _fan;
+
+		/// Returns the decomposition for the clip's current local vertices, rebuilding it if they changed, or NULL if the clip
+		/// has weighted vertices.
+		ClippingCache *getCache(Slot &slot, ClippingAttachment *clip);
+
+		void disposeCaches();
+
+		void computeBounds();
+
+		/// Returns true if the triangle is inside the clipping polygon, using the same edge test as clip().
+		bool contains(size_t polygon, float x1, float y1, float x2, float y2, float x3, float y3);
+
+		/// Returns 1 if the clipping area is a rectangle containing all the triangles, -1 if the triangles' bounds do not
+		/// overlap the clipping area, else 0.
+		int classify(float *vertices, unsigned short *triangles, size_t trianglesLength, size_t stride);
 
 		/** Clips the input triangle against the convex, clockwise clipping area. If the triangle lies entirely within the clipping
 		  * area, false is returned. The clipping area must duplicate the first vertex at the end of the vertices list. */
@@ -82,6 +179,20 @@ namespace spine {
 				  Vector<float> *output);
 
 		static void makeClockwise(Vector<float> &polygon);
+
+		void clipTrianglesShared(float *vertices, unsigned short *triangles, size_t trianglesLength, float *uvs, size_t stride);
+
+		/// Like clip(), but tracks where each vertex of the clipped polygon comes from. The result is in _sharedOutput.
+		bool clipShared(size_t triangle, unsigned short *indices, float x1, float y1, float x2, float y2, float x3, float y3,
+						size_t polygon);
+
+		/// Returns the output vertex for the input vertex, writing it the first time.
+		unsigned short sharedVertex(int index, float *vertices, float *uvs, size_t stride);
+
+		/// Returns the output vertex for the clipped polygon's vertex, writing it and interpolating its UVs the first time.
+		unsigned short sharedVertex(const ClipVertex &vertex, float *vertices, float *uvs, size_t stride, const TriangleUVs &triangle);
+
+		static uint64_t intersectionKey(size_t triangle, unsigned short *indices, int line, int edge);
 	};
 }
 
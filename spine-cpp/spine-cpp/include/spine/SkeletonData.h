@@ -52,6 +52,8 @@ namespace spine {
 
     class PhysicsConstraintData;
 
+	class UpdateCacheProgram;
+
 /// Stores the setup pose and all of the stateless data for a skeleton.
 	class SP_API SkeletonData : public SpineObject {
 		friend class SkeletonBinary;
@@ -167,6 +169,13 @@ namespace spine {
 
 		void setFps(float inValue);
 
+		/// The update cache programs created by Skeleton::updateCache() for the skins of this skeleton data.
+		Vector<UpdateCacheProgram *> &getUpdateCachePrograms();
+
+		/// Disposes the cached update cache programs. Must be called if bones, constraints or weighted path attachments are
+		/// added to or removed from the skeleton data or its skins after skeletons were created.
+		void clearUpdateCachePrograms();
+
 	private:
 		String _name;
 		Vector<BoneData *> _bones; // Ordered parents first
@@ -189,6 +198,8 @@ namespace spine {
 		float _fps;
 		String _imagesPath;
 		String _audioPath;
+
+		Vector<UpdateCacheProgram *> _updateCachePrograms;
 	};
 }
 
@@ -75,12 +75,17 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// If greater than 0, CurveTimeline1 timelines are quantized with CurveTimeline1::quantize() using this tolerance as
+		/// animations are read. Defaults to 0.
+		void setQuantizationTolerance(float tolerance) { _quantizationTolerance = tolerance; }
+
 		String &getError() { return _error; }
 
 	private:
 		AttachmentLoader *_attachmentLoader;
 		Vector<LinkedMesh *> _linkedMeshes;
 		float _scale;
+		float _quantizationTolerance;
 		const bool _ownsLoader;
 		String _error;
 
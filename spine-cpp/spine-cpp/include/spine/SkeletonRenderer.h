@@ -36,19 +36,137 @@
 namespace spine {
     class Skeleton;
 
+    enum IndexFormat {
+        /// Indices are written to RenderCommand::indices, a batch has fewer than 65535 indices.
+        IndexFormat_UInt16,
+        /// Indices are written to RenderCommand::indices32, a batch is only limited by the renderer's batch caps.
+        IndexFormat_UInt32
+    };
+
     struct SP_API RenderCommand {
         float *positions;
         float *uvs;
         uint32_t *colors;
         uint32_t *darkColors;
         int32_t numVertices;
+        /// NULL with IndexFormat_UInt32.
         uint16_t *indices;
+        /// NULL with IndexFormat_UInt16.
+        uint32_t *indices32;
         int32_t numIndices;
         BlendMode blendMode;
         void *texture;
         RenderCommand *next;
     };
 
+    class Slot;
+
+    /// A 2D affine transform applied to a skeleton's vertices when rendering many skeletons at once: x' = a * x + b * y + x,
+    /// y' = c * x + d * y + y, the same convention as the world transform of a bone.
+    struct SP_API SkeletonTransform {
+        float a, b, x;
+        float c, d, y;
+
+        SkeletonTransform() : a(1), b(0), x(0), c(0), d(1), y(0) {
+        }
+
+        SkeletonTransform(float a, float b, float c, float d, float x, float y) : a(a), b(b), x(x), c(c), d(d), y(y) {
+        }
+    };
+
+    enum VertexUVFormat {
+        /// Two floats.
+        VertexUVFormat_Float,
+        /// Two uint16_t, normalized to [0, 65535].
+        VertexUVFormat_UNorm16
+    };
+
+    enum VertexColorFormat {
+        /// A uint32_t with the channels 0xAARRGGBB, the format of RenderCommand::colors.
+        VertexColorFormat_ARGB,
+        /// A uint32_t with the channels 0xAABBGGRR, ie the bytes R, G, B, A in memory on little endian machines.
+        VertexColorFormat_ABGR
+    };
+
+    /// The memory layout of an interleaved vertex, see RenderBuffer::setVertices(void *, const VertexLayout &, int). Offsets
+    /// and the stride are in bytes. An offset of -1 omits the attribute. Positions are always two floats.
+    struct SP_API VertexLayout {
+        int stride;
+        int positionOffset;
+        int uvOffset;
+        int colorOffset;
+        int darkColorOffset;
+        VertexUVFormat uvFormat;
+        VertexColorFormat colorFormat;
+
+        VertexLayout(int stride, int positionOffset, int uvOffset, int colorOffset, int darkColorOffset,
+                     VertexUVFormat uvFormat = VertexUVFormat_Float, VertexColorFormat colorFormat = VertexColorFormat_ARGB)
+            : stride(stride), positionOffset(positionOffset), uvOffset(uvOffset), colorOffset(colorOffset),
+              darkColorOffset(darkColorOffset), uvFormat(uvFormat), colorFormat(colorFormat) {
+        }
+    };
+
+    /// Caller owned vertex and index arrays that SkeletonRenderer::render(Skeleton &, RenderBuffer &) writes batches into
+    /// directly, eg persistently mapped GPU buffers. Vertices and indices are appended until flush() is called, so the
+    /// batches of many render calls can share the arrays.
+    class SP_API RenderBuffer {
+        friend class SkeletonRenderer;
+
+    public:
+        RenderBuffer();
+
+        virtual ~RenderBuffer();
+
+        /// Sets the vertex arrays, each with room for maxVertices vertices. darkColors may be NULL if two color tinting is
+        /// not used. Resets the vertex and index counts.
+        void setVertices(float *positions, float *uvs, uint32_t *colors, uint32_t *darkColors, int maxVertices);
+
+        /// Sets an interleaved vertex array with room for maxVertices vertices of the layout. The batches passed to draw()
+        /// then have no vertex arrays, their vertices start at firstVertex in the interleaved array. Resets the vertex and
+        /// index counts.
+        void setVertices(void *vertices, const VertexLayout &layout, int maxVertices);
+
+        /// Sets the index array with room for maxIndices indices. Resets the vertex and index counts.
+        void setIndices(uint16_t *indices, int maxIndices);
+
+        /// Sets a 32-bit index array with room for maxIndices indices. Batches then have RenderCommand::indices32 set and
+        /// are only limited by the renderer's batch caps. Resets the vertex and index counts.
+        void setIndices(uint32_t *indices, int maxIndices);
+
+        int getMaxVertices();
+
+        int getMaxIndices();
+
+        /// The number of vertices written since the arrays were set or flushed.
+        int getVertexCount();
+
+        /// The number of indices written since the arrays were set or flushed.
+        int getIndexCount();
+
+        /// Called for each batch after its vertices and indices were written. The command's arrays point into the buffer's
+        /// arrays, starting at firstVertex and firstIndex, and its indices are relative to firstVertex. With an interleaved
+        /// vertex array, the command's vertex arrays are NULL. The command is only valid during the call.
+        virtual void draw(RenderCommand &batch, int firstVertex, int firstIndex) = 0;
+
+        /// Called when the next attachment does not fit in the remaining capacity, after all batches written so far were
+        /// drawn. numVertices and numIndices are the attachment's counts. When it returns, the arrays are written from the
+        /// start again. The arrays may also be replaced by calling setVertices() and setIndices(), eg with larger ones if the
+        /// attachment does not fit in the empty arrays. An attachment that still does not fit is not rendered.
+        virtual void flush(int numVertices, int numIndices) = 0;
+
+    private:
+        float *_positions;
+        float *_uvs;
+        uint32_t *_colors;
+        uint32_t *_darkColors;
+        uint8_t *_vertices;
+        VertexLayout _layout;
+        uint16_t *_indices;
+        uint32_t *_indices32;
+        int _maxVertices, _maxIndices;
+        int _vertexCount, _indexCount;
+    };
+
     class SP_API SkeletonRenderer: public SpineObject {
     public:
         explicit SkeletonRenderer();
@@ -56,12 +174,78 @@ namespace spine {
         ~SkeletonRenderer();
 
         RenderCommand *render(Skeleton &skeleton);
+
+        /// Renders the skeletons in order into one command chain. Batches continue across skeletons when texture, blend mode
+        /// and colors match, so skeletons sharing an atlas page need only a few draw calls. If transforms is not NULL, it has
+        /// a transform for each skeleton that is applied to its vertices.
+        RenderCommand *render(Vector<Skeleton *> &skeletons, Vector<SkeletonTransform> *transforms = NULL);
+
+        IndexFormat getIndexFormat();
+
+        /// Sets the index format of the render commands returned by render(Skeleton &). Default is IndexFormat_UInt16.
+        void setIndexFormat(IndexFormat format);
+
+        int getMaxBatchVertices();
+
+        /// The maximum number of vertices of a batch. A single attachment with more vertices is still rendered as one batch.
+        /// Default is no limit.
+        void setMaxBatchVertices(int maxBatchVertices);
+
+        int getMaxBatchIndices();
+
+        /// The maximum number of indices of a batch. With IndexFormat_UInt16, batches also have fewer than 65535 indices.
+        /// Default is no limit.
+        void setMaxBatchIndices(int maxBatchIndices);
+
+        /// The clipper used for clipping attachments, eg to enable SkeletonClipping::setShareVertices() or to read its counts.
+        SkeletonClipping &getClipping();
+
+        /// Writes the skeleton's vertices and indices directly into the buffer and calls RenderBuffer::draw() for each batch,
+        /// deciding batch boundaries the same way as render(Skeleton &). Nothing is copied to intermediate render commands.
+        void render(Skeleton &skeleton, RenderBuffer &buffer);
+
+        /// Writes the skeletons in order directly into the buffer, batching across skeletons the same way as
+        /// render(Vector<Skeleton *> &, Vector<SkeletonTransform> *).
+        void render(Vector<Skeleton *> &skeletons, Vector<SkeletonTransform> *transforms, RenderBuffer &buffer);
+
+        /// Computes the number of vertices and indices render() writes for the skeleton, including clipping.
+        void measure(Skeleton &skeleton, int &numVertices, int &numIndices);
+
+        /// Computes the number of vertices and indices render() writes for the skeletons, including clipping.
+        void measure(Vector<Skeleton *> &skeletons, int &numVertices, int &numIndices);
+
     private:
+        /// The geometry of a slot's attachment, see prepare().
+        struct SlotGeometry {
+            float *positions;
+            float *uvs;
+            unsigned short *indices;
+            int32_t numVertices;
+            int32_t numIndices;
+            uint32_t color;
+            uint32_t darkColor;
+            BlendMode blendMode;
+            void *texture;
+        };
+
+        /// Computes the world vertices of the slot's attachment, clipped if a clipping attachment is active, and applies the
+        /// transform if not NULL. Returns false if the slot renders nothing. Otherwise the caller must call
+        /// SkeletonClipping::clipEnd(Slot &) after using the geometry.
+        bool prepare(Skeleton &skeleton, Slot &slot, const SkeletonTransform *transform, SlotGeometry &geometry);
+
+        RenderCommand *render(Skeleton **skeletons, SkeletonTransform *transforms, int count);
+
+        void render(Skeleton **skeletons, SkeletonTransform *transforms, int count, RenderBuffer &buffer);
+
+        void measure(Skeleton **skeletons, int count, int &numVertices, int &numIndices);
+
         BlockAllocator _allocator;
         Vector<float> _worldVertices;
         Vector<unsigned short> _quadIndices;
         SkeletonClipping _clipping;
         Vector<RenderCommand *> _renderCommands;
+        IndexFormat _indexFormat;
+        int _maxBatchVertices, _maxBatchIndices;
     };
 }
 
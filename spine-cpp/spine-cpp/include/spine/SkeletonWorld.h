@@ -0,0 +1,243 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonWorld_h
+#define Spine_SkeletonWorld_h
+
+#include <spine/Physics.h>
+#include <spine/TaskExecutor.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class AnimationState;
+
+	class AnimationStateData;
+
+	class Skeleton;
+
+	class SkeletonData;
+
+	class SkeletonRenderer;
+
+	struct RenderCommand;
+
+	/// A skeleton and animation state owned by a SkeletonWorld.
+	class SP_API SkeletonWorldInstance : public SpineObject {
+		friend class SkeletonWorld;
+
+	public:
+		Skeleton &getSkeleton();
+
+		AnimationState &getAnimationState();
+
+		/// The render commands of the last SkeletonWorld::update().
+		/// @return May be NULL if rendering is disabled or the skeleton has nothing to render.
+		RenderCommand *getRenderCommands();
+
+		/// Inactive instances are skipped by SkeletonWorld::update().
+		bool isActive();
+
+		void setActive(bool inValue);
+
+		int getUpdateInterval();
+
+		/// The instance is updated every this many SkeletonWorld::update() calls, with the time of the skipped calls
+		/// accumulated, so animation events, physics and the animation time are the same as when updating every call. Defaults
+		/// to 1.
+		void setUpdateInterval(int inValue);
+
+		float getPriority();
+
+		/// When the world has an update budget, instances that are due are updated in order of their priority multiplied by
+		/// how overdue they are. Defaults to 1.
+		void setPriority(float inValue);
+
+		bool getInterpolateBones();
+
+		/// If true, on calls that do not update the instance the bone world transforms are interpolated between the last two
+		/// updates. The interpolated pose trails the animation by up to one update interval. If the world renders, the render
+		/// commands are interpolated too, see setInterpolateVertices(). Defaults to false.
+		void setInterpolateBones(bool inValue);
+
+		bool getInterpolateVertices();
+
+		/// If true and the world renders, on calls that do not update the instance the positions of the render commands are
+		/// interpolated between the last two renders, if both had the same number of vertices. Always done when bones are
+		/// interpolated. Defaults to false.
+		void setInterpolateVertices(bool inValue);
+
+		SkeletonWorldInstance *getSource();
+
+		/// If not NULL, this instance does not apply its own animation state. After the source was updated, the source's bone
+		/// transforms, slot colors, attachments, deforms and draw order are copied to this instance instead, so many instances
+		/// playing the same animation in sync are evaluated once. The source's world transforms are moved to this instance's
+		/// skeleton position and scaled by the ratio of the skeletons' scales. This matches evaluating the instance itself
+		/// unless the ratio differs between x and y and bones do not inherit rotation, scale or reflection. Physics and the
+		/// instance's own animation state are not updated. The source must use the same SkeletonData and skin and must not
+		/// have a source itself.
+		///
+		/// For instances playing the same animation with different time offsets, a few sources can be created with offsets
+		/// bucketed into phases, eg by setting the track time of each source, and each instance can share the source of the
+		/// nearest phase, see SkeletonWorld::findNearestPhase().
+		void setSource(SkeletonWorldInstance *source);
+
+		/// Returns true if the last SkeletonWorld::update() applied the animation state and updated the world transforms of
+		/// this instance, false if it kept or interpolated the previous pose.
+		bool wasUpdated();
+
+		~SkeletonWorldInstance();
+
+	private:
+		SkeletonWorldInstance(SkeletonData *skeletonData, AnimationStateData *stateData);
+
+		/// Applies the time accumulated since the previous update.
+		void update(float delta, Physics physics, bool render);
+
+		/// Advances the time since the last update by delta and shows the pose between the last two updates.
+		void interpolate(float delta);
+
+		/// Copies the pose of the source, see setSource(SkeletonWorldInstance *).
+		void share(bool render);
+
+		/// Stores the bone and vertex pose of the update, keeping the previous one.
+		void storePose();
+
+		/// Writes the interpolated bone and vertex pose for the time since the last update.
+		void showPose();
+
+		Skeleton *_skeleton;
+		AnimationState *_state;
+		SkeletonRenderer *_renderer;
+		RenderCommand *_renderCommands;
+		bool _active;
+		SkeletonWorldInstance *_source;
+		int _updateInterval;
+		float _priority;
+		bool _interpolateBones, _interpolateVertices;
+		bool _updated, _posed;
+		int _skippedUpdates;
+		float _pendingDelta, _updateDelta, _elapsed;
+		Vector<float> _previousBones, _currentBones;
+		Vector<float> _previousVertices, _currentVertices;
+	};
+
+	/// Owns many independent skeleton instances and updates them in parallel. For each active instance,
+	/// SkeletonWorld::update() advances and applies the animation state, advances the skeleton's physics time, updates the
+	/// world transforms and, if enabled, renders the skeleton. Instances are independent, so the results do not depend on
+	/// the executor or the number of threads.
+	///
+	/// Animation state listeners are called on the executor's threads. Skeleton and animation state data, as well as
+	/// attachments, are shared read-only between instances, except that rendering an attachment with a Sequence
+	/// changes the attachment's region: instances sharing such attachments must not be rendered by the world.
+	class SP_API SkeletonWorld : public SpineObject, public Task {
+	public:
+		/// @param executor Runs the instance updates, not owned. If NULL, the world creates and owns a WorkStealingPool
+		/// using all hardware threads.
+		explicit SkeletonWorld(TaskExecutor *executor = NULL);
+
+		~SkeletonWorld();
+
+		/// Creates an instance. The data must outlive the world.
+		SkeletonWorldInstance *addInstance(SkeletonData *skeletonData, AnimationStateData *stateData);
+
+		/// Disposes the instance. Instances that shared its pose get no source, so they are updated on their own again.
+		void removeInstance(SkeletonWorldInstance *instance);
+
+		Vector<SkeletonWorldInstance *> &getInstances();
+
+		/// Updates the active instances that are due, see SkeletonWorldInstance::setUpdateInterval(int). Must not be called
+		/// concurrently with any other use of the world or its instances.
+		void update(float delta);
+
+		size_t getUpdateBudget();
+
+		/// The most instances a call to update() updates, or 0 for no limit. Due instances over the budget keep accumulating
+		/// time and are updated by a later call. Instances that were never updated are always updated. Defaults to 0.
+		void setUpdateBudget(size_t inValue);
+
+		/// The number of instances updated by the last update(), without the instances that were only interpolated or that
+		/// share the pose of a source. This is the number of unique animation evaluations.
+		size_t getUpdatedCount();
+
+		/// The number of instances that copied the pose of their source in the last update().
+		size_t getSharedCount();
+
+		/// Returns the source whose current entry on the track is nearest the animation time, see
+		/// TrackEntry::getAnimationTime(). For a looping entry the distance wraps around the loop. Sources without a current
+		/// entry on the track are skipped.
+		/// @return May be NULL if no source has a current entry on the track.
+		static SkeletonWorldInstance *
+		findNearestPhase(Vector<SkeletonWorldInstance *> &sources, float animationTime, size_t trackIndex = 0);
+
+		TaskExecutor &getExecutor();
+
+		Physics getPhysics();
+
+		/// The physics mode passed to Skeleton::updateWorldTransform(). Defaults to Physics_Update.
+		void setPhysics(Physics inValue);
+
+		bool getRenderEnabled();
+
+		/// If true, each instance is rendered with its own SkeletonRenderer after its world transforms were updated.
+		/// Defaults to false.
+		void setRenderEnabled(bool inValue);
+
+		size_t getGrainSize();
+
+		/// The number of instances a thread updates before checking for more work. Defaults to 4.
+		void setGrainSize(size_t inValue);
+
+	private:
+		/// Updates the instances in [start, end) with the state of the current update(), or copies the poses of the shared
+		/// instances in [start, end) when sharing.
+		virtual void run(size_t start, size_t end);
+
+		/// How urgently a due instance needs an update when the world has an update budget.
+		static float updateScore(SkeletonWorldInstance *instance);
+
+		/// Moves the n due instances with the highest scores to the front of the due instances, in no particular order.
+		void selectHighestScores(size_t n);
+
+		Vector<SkeletonWorldInstance *> _instances;
+		TaskExecutor *_executor;
+		bool _ownsExecutor;
+		Physics _physics;
+		bool _renderEnabled;
+		size_t _grainSize;
+		float _delta;
+		size_t _updateBudget;
+		size_t _updatedCount;
+		Vector<SkeletonWorldInstance *> _due;
+		Vector<float> _dueScores;
+		Vector<SkeletonWorldInstance *> _shared;
+		bool _sharing;
+	};
+}
+
+#endif /* Spine_SkeletonWorld_h */
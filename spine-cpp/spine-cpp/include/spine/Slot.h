@@ -44,6 +44,8 @@ namespace spine {
 	class Attachment;
 
 	class SP_API Slot : public SpineObject {
+		friend class BakedAnimation;
+
 		friend class VertexAttachment;
 
 		friend class Skeleton;
@@ -52,6 +54,8 @@ namespace spine {
 
 		friend class SkeletonClipping;
 
+		friend class SkeletonWorldInstance;
+
 		friend class AttachmentTimeline;
 
 		friend class RGBATimeline;
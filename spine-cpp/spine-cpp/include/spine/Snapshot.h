@@ -0,0 +1,242 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_Snapshot_h
+#define Spine_Snapshot_h
+
+#include <spine/Extension.h>
+#include <spine/Vector.h>
+
+#include <stdint.h>
+#include <string.h>
+
+namespace spine {
+	/// The header of a snapshot written by Skeleton::writeSnapshot() or AnimationState::writeSnapshot(). Snapshots store
+	/// the state as plain values and pointers to the shared data (attachments, skins, animations), so a snapshot can be copied
+	/// with memcpy but is only valid for the same data in the same process.
+	struct SP_API SnapshotHeader {
+		static const uint32_t MAGIC = 0x53505353;
+		static const uint32_t VERSION = 2;
+
+		enum Type {
+			Type_Skeleton = 1,
+			Type_AnimationState = 2
+		};
+
+		uint32_t magic;
+		uint32_t version;
+		uint32_t type;
+		uint32_t size;
+		/// The SkeletonData or AnimationStateData of the snapshot's owner.
+		const void *data;
+
+		/// Copies the header from the buffer.
+		/// @return False if the buffer does not hold a snapshot of the type and data or is smaller than the snapshot.
+		static bool read(const void *buffer, size_t size, Type type, const void *data, SnapshotHeader &header) {
+			if (!buffer || size < sizeof(SnapshotHeader)) return false;
+			memcpy(&header, buffer, sizeof(SnapshotHeader));
+			return header.magic == MAGIC && header.version == VERSION && header.type == (uint32_t) type &&
+				   header.data == data && header.size <= size;
+		}
+	};
+
+	/// Writes a snapshot's values. With a NULL buffer, only the size is computed.
+	class SP_API SnapshotWriter : public SpineObject {
+	public:
+		SnapshotWriter(void *buffer, size_t capacity) : _buffer((char *) buffer), _capacity(capacity), _size(0) {
+		}
+
+		bool isReading() {
+			return false;
+		}
+
+		template<typename T>
+		void value(T &value) {
+			values(&value, 1);
+		}
+
+		template<typename T>
+		void values(T *values, size_t count) {
+			size_t length = sizeof(T) * count;
+			if (_buffer && length && _size + length <= _capacity) memcpy(_buffer + _size, values, length);
+			_size += length;
+		}
+
+		/// Writes the number of items that follow.
+		void count(size_t &count, size_t itemSize) {
+			SP_UNUSED(itemSize);
+			uint32_t value32 = (uint32_t) count;
+			value(value32);
+		}
+
+		/// Writes the vector's size followed by its items.
+		template<typename T>
+		void vector(Vector<T> &vector) {
+			size_t size = vector.size();
+			count(size, sizeof(T));
+			values(vector.buffer(), size);
+		}
+
+		size_t getSize() {
+			return _size;
+		}
+
+		/// Returns false if the buffer was too small for the values written.
+		bool isValid() {
+			return _buffer && _size <= _capacity;
+		}
+
+	private:
+		char *_buffer;
+		size_t _capacity;
+		size_t _size;
+	};
+
+	/// Reads a snapshot's values with the same calls the SnapshotWriter wrote them with.
+	class SP_API SnapshotReader : public SpineObject {
+	public:
+		SnapshotReader(const void *buffer, size_t size) : _buffer((const char *) buffer), _size(size), _position(0),
+														  _valid(true) {
+		}
+
+		bool isReading() {
+			return true;
+		}
+
+		template<typename T>
+		void value(T &value) {
+			values(&value, 1);
+		}
+
+		template<typename T>
+		void values(T *values, size_t count) {
+			size_t length = sizeof(T) * count;
+			if (!_valid || _position + length > _size) {
+				_valid = false;
+				return;
+			}
+			if (!length) return;
+			memcpy(values, _buffer + _position, length);
+			_position += length;
+		}
+
+		/// Reads the number of items that follow. The count is 0 if the rest of the snapshot is too small for that many items.
+		void count(size_t &count, size_t itemSize) {
+			uint32_t value32 = 0;
+			value(value32);
+			count = value32;
+			if (_valid && count * itemSize > _size - _position) _valid = false;
+			if (!_valid) count = 0;
+		}
+
+		/// Reads a vector written by SnapshotWriter::vector(). Only allocates if the vector's capacity is too small.
+		template<typename T>
+		void vector(Vector<T> &vector) {
+			size_t size = 0;
+			count(size, sizeof(T));
+			vector.setSize(size, T());
+			values(vector.buffer(), size);
+		}
+
+		/// Returns false if the snapshot ended before all values were read.
+		bool isValid() {
+			return _valid;
+		}
+
+	private:
+		const char *_buffer;
+		size_t _size;
+		size_t _position;
+		bool _valid;
+	};
+
+	/// Checks that a snapshot holds all values a SnapshotReader would read, without storing them. Acts as a writer, so the
+	/// values passed in are left unchanged.
+	class SP_API SnapshotValidator : public SpineObject {
+	public:
+		SnapshotValidator(const void *buffer, size_t size) : _buffer((const char *) buffer), _size(size), _position(0),
+															 _valid(true) {
+		}
+
+		bool isReading() {
+			return false;
+		}
+
+		template<typename T>
+		void value(T &value) {
+			SP_UNUSED(value);
+			skip(sizeof(T));
+		}
+
+		template<typename T>
+		void values(T *values, size_t count) {
+			SP_UNUSED(values);
+			skip(sizeof(T) * count);
+		}
+
+		/// Reads the number of items that follow, like SnapshotReader::count().
+		void count(size_t &count, size_t itemSize) {
+			uint32_t value32 = 0;
+			if (_valid && _position + sizeof(uint32_t) <= _size) memcpy(&value32, _buffer + _position, sizeof(uint32_t));
+			skip(sizeof(uint32_t));
+			count = value32;
+			if (_valid && count * itemSize > _size - _position) _valid = false;
+			if (!_valid) count = 0;
+		}
+
+		template<typename T>
+		void vector(Vector<T> &vector) {
+			SP_UNUSED(vector);
+			size_t size = 0;
+			count(size, sizeof(T));
+			skip(sizeof(T) * size);
+		}
+
+		/// Returns false if the snapshot ends before all values.
+		bool isValid() {
+			return _valid;
+		}
+
+	private:
+		void skip(size_t length) {
+			if (!_valid || _position + length > _size) {
+				_valid = false;
+				return;
+			}
+			_position += length;
+		}
+
+		const char *_buffer;
+		size_t _size;
+		size_t _position;
+		bool _valid;
+	};
+}
+
+#endif /* Spine_Snapshot_h */
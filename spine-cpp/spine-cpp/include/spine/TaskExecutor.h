@@ -0,0 +1,58 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_TaskExecutor_h
+#define Spine_TaskExecutor_h
+
+#include <spine/SpineObject.h>
+
+#include <stddef.h>
+
+namespace spine {
+	/// Work split into independent items that can be run concurrently.
+	class SP_API Task {
+	public:
+		virtual ~Task() {}
+
+		/// Runs the items in the range [start, end). May be called concurrently for disjoint ranges.
+		virtual void run(size_t start, size_t end) = 0;
+	};
+
+	/// Runs tasks on some set of threads. Implement this to run SkeletonWorld on an engine's own job system.
+	class SP_API TaskExecutor : public SpineObject {
+	public:
+		virtual ~TaskExecutor() {}
+
+		/// Runs all items in [0, count) of the task and returns once every item has completed. Items are passed to
+		/// Task::run() in ranges of at most grainSize items. The order and threads the ranges run on are unspecified.
+		virtual void execute(Task &task, size_t count, size_t grainSize) = 0;
+	};
+}
+
+#endif /* Spine_TaskExecutor_h */
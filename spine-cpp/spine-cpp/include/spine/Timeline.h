@@ -74,6 +74,9 @@ namespace spine {
 
 		virtual Vector <PropertyId> &getPropertyIds();
 
+		/// The number of bytes used by the timeline's frames and curves.
+		virtual size_t getMemorySize();
+
 	protected:
 		void setPropertyIds(PropertyId propertyIds[], size_t propertyIdsCount);
 
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_TrackMask_h
+#define Spine_TrackMask_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class SkeletonData;
+
+	class Timeline;
+
+	/// Weights per bone and slot that limit which parts of the skeleton a TrackEntry animates, see
+	/// TrackEntry::setMask(TrackMask *). A timeline is applied with the track entry's alpha multiplied by the weight of the
+	/// bone or slot it changes. Timelines with a weight of 0 are not applied at all. Timelines of constraints, the draw order
+	/// and events are not masked.
+	///
+	/// A mask can be shared by any number of track entries of skeletons using the same SkeletonData.
+	class SP_API TrackMask : public SpineObject {
+		friend class AnimationState;
+
+	public:
+		/// Creates a mask with a weight of 1 for all bones and slots of the skeleton data.
+		explicit TrackMask(SkeletonData &skeletonData);
+
+		float getBoneWeight(int boneIndex);
+
+		/// Sets the weight of the bone's timelines and the timelines of the bone's slots.
+		/// @param descendants If true, the weight is also set for all descendants of the bone and their slots.
+		void setBoneWeight(int boneIndex, float weight, bool descendants);
+
+		float getSlotWeight(int slotIndex);
+
+		void setSlotWeight(int slotIndex, float weight);
+
+		/// Sets the weight of all bones and slots.
+		void setWeights(float weight);
+
+		/// Returns the weight of the bone or slot the timeline changes, or 1 if the timeline is not masked.
+		float getTimelineWeight(Timeline &timeline);
+
+	private:
+		SkeletonData &_skeletonData;
+		Vector<float> _boneWeights;
+		Vector<float> _slotWeights;
+		int _version;
+	};
+}
+
+#endif /* Spine_TrackMask_h */
@@ -46,6 +46,9 @@ namespace spine {
 		Vector<int> &triangles
 		);
 
+		/// The vertex offsets (vertex index * 2) of each polygon returned by the last call to decompose().
+		Vector<Vector<int> *> &getConvexPolygonsIndices();
+
 	private:
 		Vector<Vector < float>* >
 		_convexPolygons;
@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_UpdateCacheProgram_h
+#define Spine_UpdateCacheProgram_h
+
+#include <spine/Vector.h>
+
+namespace spine {
+	class Attachment;
+
+	class Skin;
+
+	/// The update cache order of a skeleton with a specific skin, stored as bone and constraint indices so it can be shared by
+	/// all skeletons of a SkeletonData. Created by the first Skeleton::updateCache() for a skin of the SkeletonData (or no skin)
+	/// and cached on the SkeletonData. Later skeletons bind to it in O(bones) instead of sorting the bones and constraints.
+	class SP_API UpdateCacheProgram : public SpineObject {
+		friend class Skeleton;
+
+	public:
+		/// The skin the program was created for.
+		/// @return May be NULL.
+		Skin *getSkin();
+
+		/// The number of bones and constraints in the update cache.
+		size_t getSize();
+
+	private:
+		enum EntryType {
+			EntryType_Bone,
+			EntryType_Ik,
+			EntryType_Transform,
+			EntryType_Path,
+			EntryType_Physics
+		};
+
+		struct Entry {
+			EntryType type;
+			int index;
+		};
+
+		explicit UpdateCacheProgram(Skin *skin);
+
+		Skin *_skin;
+		Vector<Entry> _entries;
+		Vector<bool> _bonesActive;
+		Vector<bool> _ikConstraintsActive;
+		Vector<bool> _transformConstraintsActive;
+		Vector<bool> _pathConstraintsActive;
+		Vector<bool> _physicsConstraintsActive;
+		/// The path attachments of the program's skin and the default skin for the active path constraints' target slots, and
+		/// the path attachment each target slot showed when the program was created. A skeleton whose target slot shows any
+		/// other path attachment must be sorted.
+		Vector<Attachment *> _pathAttachments;
+	};
+}
+
+#endif /* Spine_UpdateCacheProgram_h */
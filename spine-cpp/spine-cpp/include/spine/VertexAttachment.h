@@ -33,6 +33,7 @@
 #include <spine/Attachment.h>
 
 #include <spine/Vector.h>
+#include <spine/VertexSkinning.h>
 
 namespace spine {
 	class Slot;
@@ -85,11 +86,16 @@ namespace spine {
 
 		void copyTo(VertexAttachment *other);
 
+		/// Rebuilds the layout used to compute weighted world vertices. Must be called after Bones or Vertices are
+		/// modified, otherwise the layout is ignored if their sizes changed or yields stale results if they did not.
+		void updateSkinning();
+
 	protected:
 		Vector <int> _bones;
 		Vector<float> _vertices;
 		size_t _worldVerticesLength;
 		Attachment *_timelineAttachment;
+		VertexSkinning _skinning;
 
 	private:
 		const int _id;
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_VertexSkinning_h
+#define Spine_VertexSkinning_h
+
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+	class Bone;
+
+	/// The weighted vertices of a VertexAttachment re-laid out for skinning. Vertices are bucketed by their number of bone
+	/// influences and each bucket stores bone indices, local positions and weights as structure-of-arrays blocks, so the
+	/// influences of several vertices are transformed at once.
+	///
+	/// The kernels are selected at build time: AVX2 if __AVX2__ is defined, else SSE2 on x86 and x64, else NEON if
+	/// __ARM_NEON is defined, else a scalar fallback. Define SPINE_NO_SIMD to always use the scalar fallback. All variants
+	/// produce the same results as VertexAttachment::computeWorldVertices() without a layout.
+	class SP_API VertexSkinning : public SpineObject {
+	public:
+		VertexSkinning();
+
+		~VertexSkinning();
+
+		/// Builds the layout from the bones and vertices of a weighted VertexAttachment. Clears the layout if the vertices
+		/// are not weighted.
+		void build(Vector<int> &bones, Vector<float> &vertices);
+
+		/// Returns true if the layout was built from bones and vertices of the given sizes.
+		bool isBuilt(size_t bonesCount, size_t verticesCount);
+
+		void clear();
+
+		/// Computes the world positions of all vertices.
+		/// @param deform The slot's deform offsets, two per influence, or NULL.
+		/// @return False if the layout could not be used, in which case nothing was written.
+		bool computeWorldVertices(Vector<Bone *> &skeletonBones, float *deform, float *worldVertices, size_t offset,
+								  size_t stride);
+
+		/// Transforms vertexCount unweighted vertices by the given world transform.
+		static void transform(const float *vertices, size_t vertexCount, float a, float b, float c, float d, float x,
+							  float y, float *worldVertices, size_t stride);
+
+		/// Transforms the four vertex offsets of a region attachment, stored bl, ul, ur, br, and writes them in the order
+		/// br, bl, ul, ur.
+		static void transformRegion(const float *offsets, float a, float b, float c, float d, float x, float y,
+									float *worldVertices, size_t stride);
+
+		/// Returns the name of the instruction set the kernels were built for: "AVX2", "SSE2", "NEON" or "scalar".
+		static const char *getInstructionSet();
+
+	private:
+		/// Vertices with the same number of influences, padded to a multiple of the widest kernel. Influence j of vertex v
+		/// of the bucket is at start + j * paddedCount + v in the influence arrays.
+		struct Bucket {
+			int influenceCount;
+			int vertexCount;
+			int paddedCount;
+			int vertexStart;
+			int start;
+		};
+
+		Vector<Bucket> _buckets;
+		Vector<int> _vertexIndices;
+		Vector<int> _skinBones;
+		Vector<int> _boneIndices;
+		Vector<int> _deformOffsets;
+		Vector<float> _x;
+		Vector<float> _y;
+		Vector<float> _weights;
+		size_t _bonesCount;
+		size_t _verticesCount;
+	};
+}
+
+#endif /* Spine_VertexSkinning_h */
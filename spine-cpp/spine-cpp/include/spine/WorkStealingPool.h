@@ -0,0 +1,62 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_WorkStealingPool_h
+#define Spine_WorkStealingPool_h
+
+#include <spine/TaskExecutor.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	/// A TaskExecutor backed by a fixed set of worker threads. The items of a task are split evenly between the workers and
+	/// the calling thread, each takes grain sized ranges from the front of its own share and steals half of another
+	/// share from the back once its own is exhausted.
+	///
+	/// Define SPINE_NO_THREADS to build without std::thread, tasks are then run on the calling thread.
+	class SP_API WorkStealingPool : public TaskExecutor {
+	public:
+		/// @param threadCount The number of threads running tasks, including the calling thread. If 0, the number of
+		/// hardware threads is used.
+		explicit WorkStealingPool(int threadCount = 0);
+
+		virtual ~WorkStealingPool();
+
+		virtual void execute(Task &task, size_t count, size_t grainSize);
+
+		/// The number of threads running tasks, including the calling thread.
+		int getThreadCount();
+
+	private:
+		struct State;
+
+		State *_state;
+	};
+}
+
+#endif /* Spine_WorkStealingPool_h */
@@ -31,6 +31,7 @@
 #define SPINE_SPINE_H_
 
 #include <spine/Animation.h>
+#include <spine/AnimationBaker.h>
 #include <spine/AnimationState.h>
 #include <spine/AnimationStateData.h>
 #include <spine/Atlas.h>
@@ -94,22 +95,29 @@
 #include <spine/SkeletonData.h>
 #include <spine/SkeletonJson.h>
 #include <spine/SkeletonRenderer.h>
+#include <spine/SkeletonWorld.h>
 #include <spine/Skin.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
+#include <spine/Snapshot.h>
 #include <spine/SpacingMode.h>
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
+#include <spine/TaskExecutor.h>
 #include <spine/TextureLoader.h>
 #include <spine/Timeline.h>
+#include <spine/TrackMask.h>
 #include <spine/TransformConstraint.h>
 #include <spine/TransformConstraintData.h>
 #include <spine/TransformConstraintTimeline.h>
 #include <spine/TranslateTimeline.h>
 #include <spine/Triangulator.h>
 #include <spine/Updatable.h>
+#include <spine/UpdateCacheProgram.h>
 #include <spine/Vector.h>
 #include <spine/VertexAttachment.h>
+#include <spine/VertexSkinning.h>
 #include <spine/Vertices.h>
+#include <spine/WorkStealingPool.h>
 
 #endif
@@ -41,7 +41,8 @@ using namespace spine;
 Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(timelines),
 																						  _timelineIds(),
 																						  _duration(duration),
-																						  _name(name) {
+																						  _name(name),
+																						  _index(-1) {
 	assert(_name.length() > 0);
 	for (size_t i = 0; i < timelines.size(); i++) {
 		Vector<PropertyId> propertyIds = timelines[i]->getPropertyIds();
@@ -91,8 +92,27 @@ void Animation::setDuration(float inValue) {
 	_duration = inValue;
 }
 
+size_t Animation::getMemorySize() {
+	size_t size = 0;
+	for (size_t i = 0, n = _timelines.size(); i < n; i++)
+		size += _timelines[i]->getMemorySize();
+	return size;
+}
+
 int Animation::search(Vector<float> &frames, float target) {
-	size_t n = (int) frames.size();
+	size_t n = frames.size();
+	if (n > LINEAR_SEARCH_FRAMES) {
+		// Binary search for the first frame after the target.
+		size_t low = 1, high = n;
+		while (low < high) {
+			size_t middle = (low + high) >> 1;
+			if (frames[middle] > target)
+				high = middle;
+			else
+				low = middle + 1;
+		}
+		return (int) (low - 1);
+	}
 	for (size_t i = 1; i < n; i++) {
 		if (frames[i] > target) return (int) (i - 1);
 	}
@@ -101,6 +121,17 @@ int Animation::search(Vector<float> &frames, float target) {
 
 int Animation::search(Vector<float> &frames, float target, int step) {
 	size_t n = frames.size();
+	if (n > LINEAR_SEARCH_FRAMES * step) {
+		size_t low = 1, high = n / step;
+		while (low < high) {
+			size_t middle = (low + high) >> 1;
+			if (frames[middle * step] > target)
+				high = middle;
+			else
+				low = middle + 1;
+		}
+		return (int) ((low - 1) * step);
+	}
 	for (size_t i = step; i < n; i += step)
 		if (frames[i] > target) return (int) (i - step);
 	return (int) (n - step);
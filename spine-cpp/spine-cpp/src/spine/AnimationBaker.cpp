@@ -0,0 +1,308 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/AnimationBaker.h>
+
+#include <spine/Animation.h>
+#include <spine/AttachmentTimeline.h>
+#include <spine/Bone.h>
+#include <spine/MathUtil.h>
+#include <spine/Property.h>
+#include <spine/Skeleton.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+
+using namespace spine;
+
+/// The number of points between two samples at which bake() measures the error.
+static const int ERROR_SAMPLES = 4;
+
+static float interpolate(float from, float to, float percent, bool rotate) {
+	float diff = to - from;
+	if (rotate) diff -= MathUtil::ceil(diff / 360 - 0.5f) * 360;
+	return from + diff * percent;
+}
+
+BakedAnimation::BakedAnimation(Animation &animation) : _animation(animation),
+													   _frameRate(0),
+													   _frameCount(0),
+													   _duration(animation.getDuration()),
+													   _unbakedTimelineCount(0) {
+	for (int i = 0; i <= Channel_DarkB; i++)
+		_maxErrors[i] = 0;
+}
+
+BakedAnimation::~BakedAnimation() {
+}
+
+Animation &BakedAnimation::getAnimation() {
+	return _animation;
+}
+
+float BakedAnimation::getFrameRate() {
+	return _frameRate;
+}
+
+size_t BakedAnimation::getFrameCount() {
+	return _frameCount;
+}
+
+void BakedAnimation::apply(Skeleton &skeleton, float time, bool loop, float alpha) {
+	if (loop && _duration != 0) time = MathUtil::fmod(time, _duration);
+
+	size_t frame = 0, next = 0;
+	float percent = 0;
+	if (_frameCount > 1) {
+		float position = MathUtil::clamp(time, 0, _duration) / _duration * (_frameCount - 1);
+		frame = (size_t) position;
+		if (frame >= _frameCount - 1) frame = _frameCount - 2;
+		next = frame + 1;
+		percent = MathUtil::min(position - frame, 1.0f);
+	}
+
+	Vector<Bone *> &bones = skeleton.getBones();
+	Vector<Slot *> &slots = skeleton.getSlots();
+	size_t channelCount = _channels.size();
+	float *from = _values.buffer() + frame * channelCount, *to = _values.buffer() + next * channelCount;
+	for (size_t i = 0; i < channelCount; i++) {
+		int channel = _channels[i];
+		if (channel < Channel_R ? !bones[_channelIndices[i]]->_active : !slots[_channelIndices[i]]->_bone._active) continue;
+		float value = interpolate(from[i], to[i], percent, channel == Channel_Rotate);
+		float &current = getChannelValue(skeleton, i);
+		if (channel < Channel_R) bones[_channelIndices[i]]->_modified = true;
+		if (alpha == 1)
+			current = value;
+		else
+			current += (value - current) * alpha;
+	}
+
+	size_t slotCount = _attachmentSlots.size();
+	const String **names = _attachmentNames.buffer() + (percent < 1 ? frame : next) * slotCount;
+	for (size_t i = 0; i < slotCount; i++) {
+		int slotIndex = _attachmentSlots[i];
+		Slot *slot = slots[slotIndex];
+		if (!slot->_bone._active) continue;
+		slot->setAttachment(names[i] ? skeleton.getAttachment(slotIndex, *names[i]) : NULL);
+	}
+}
+
+size_t BakedAnimation::getMemorySize() {
+	return sizeof(BakedAnimation) + _values.size() * sizeof(float) + _attachmentNames.size() * sizeof(String *) +
+		   (_channels.size() + _channelIndices.size() + _attachmentSlots.size()) * sizeof(int);
+}
+
+int BakedAnimation::getUnbakedTimelineCount() {
+	return _unbakedTimelineCount;
+}
+
+float BakedAnimation::getMaxTranslationError() {
+	return MathUtil::max(_maxErrors[Channel_X], _maxErrors[Channel_Y]);
+}
+
+float BakedAnimation::getMaxRotationError() {
+	return _maxErrors[Channel_Rotate];
+}
+
+float BakedAnimation::getMaxScaleError() {
+	return MathUtil::max(_maxErrors[Channel_ScaleX], _maxErrors[Channel_ScaleY]);
+}
+
+float BakedAnimation::getMaxShearError() {
+	return MathUtil::max(_maxErrors[Channel_ShearX], _maxErrors[Channel_ShearY]);
+}
+
+float BakedAnimation::getMaxColorError() {
+	float error = 0;
+	for (int i = Channel_R; i <= Channel_DarkB; i++)
+		error = MathUtil::max(error, _maxErrors[i]);
+	return error;
+}
+
+float &BakedAnimation::getChannelValue(Skeleton &skeleton, size_t channel) {
+	int index = _channelIndices[channel];
+	switch (_channels[channel]) {
+		case Channel_Rotate:
+			return skeleton.getBones()[index]->_rotation;
+		case Channel_X:
+			return skeleton.getBones()[index]->_x;
+		case Channel_Y:
+			return skeleton.getBones()[index]->_y;
+		case Channel_ScaleX:
+			return skeleton.getBones()[index]->_scaleX;
+		case Channel_ScaleY:
+			return skeleton.getBones()[index]->_scaleY;
+		case Channel_ShearX:
+			return skeleton.getBones()[index]->_shearX;
+		case Channel_ShearY:
+			return skeleton.getBones()[index]->_shearY;
+		case Channel_R:
+			return skeleton.getSlots()[index]->_color.r;
+		case Channel_G:
+			return skeleton.getSlots()[index]->_color.g;
+		case Channel_B:
+			return skeleton.getSlots()[index]->_color.b;
+		case Channel_A:
+			return skeleton.getSlots()[index]->_color.a;
+		case Channel_DarkR:
+			return skeleton.getSlots()[index]->_darkColor.r;
+		case Channel_DarkG:
+			return skeleton.getSlots()[index]->_darkColor.g;
+		default:
+			return skeleton.getSlots()[index]->_darkColor.b;
+	}
+}
+
+AnimationBaker::AnimationBaker(SkeletonData &skeletonData) : _skeleton(new (__FILE__, __LINE__) Skeleton(&skeletonData)) {
+	// Bones which require a skin are baked too, the skeleton playing the baked animation decides which are active.
+	Vector<Bone *> &bones = _skeleton->getBones();
+	for (size_t i = 0, n = bones.size(); i < n; i++)
+		bones[i]->_active = true;
+}
+
+AnimationBaker::~AnimationBaker() {
+	delete _skeleton;
+}
+
+BakedAnimation *AnimationBaker::bake(Animation &animation, float frameRate) {
+	assert(frameRate > 0);
+	BakedAnimation *baked = new (__FILE__, __LINE__) BakedAnimation(animation);
+
+	// Each property keyed by a bone or color timeline becomes a channel.
+	const int bakedProperties = Property_Rotate | Property_X | Property_Y | Property_ScaleX | Property_ScaleY |
+								Property_ShearX | Property_ShearY | Property_Rgb | Property_Alpha | Property_Rgb2;
+	Vector<AttachmentTimeline *> attachmentTimelines;
+	Vector<PropertyId> bakedIds;
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	for (size_t i = 0, n = timelines.size(); i < n; i++) {
+		Timeline *timeline = timelines[i];
+		if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti)) {
+			AttachmentTimeline *attachmentTimeline = static_cast<AttachmentTimeline *>(timeline);
+			baked->_attachmentSlots.add(attachmentTimeline->getSlotIndex());
+			attachmentTimelines.add(attachmentTimeline);
+			continue;
+		}
+		Vector<PropertyId> &ids = timeline->getPropertyIds();
+		bool bakeable = true;
+		for (size_t ii = 0, nn = ids.size(); ii < nn; ii++)
+			if (!((int) (ids[ii] >> 32) & bakedProperties)) bakeable = false;
+		if (!bakeable) {
+			baked->_unbakedTimelineCount++;
+			continue;
+		}
+		for (size_t ii = 0, nn = ids.size(); ii < nn; ii++) {
+			if (bakedIds.contains(ids[ii])) continue;
+			bakedIds.add(ids[ii]);
+			int index = (int) (ids[ii] & 0xffffffff);
+			int first, last;
+			switch ((int) (ids[ii] >> 32)) {
+				case Property_Rotate:
+					first = last = BakedAnimation::Channel_Rotate;
+					break;
+				case Property_X:
+					first = last = BakedAnimation::Channel_X;
+					break;
+				case Property_Y:
+					first = last = BakedAnimation::Channel_Y;
+					break;
+				case Property_ScaleX:
+					first = last = BakedAnimation::Channel_ScaleX;
+					break;
+				case Property_ScaleY:
+					first = last = BakedAnimation::Channel_ScaleY;
+					break;
+				case Property_ShearX:
+					first = last = BakedAnimation::Channel_ShearX;
+					break;
+				case Property_ShearY:
+					first = last = BakedAnimation::Channel_ShearY;
+					break;
+				case Property_Rgb:
+					first = BakedAnimation::Channel_R;
+					last = BakedAnimation::Channel_B;
+					break;
+				case Property_Alpha:
+					first = last = BakedAnimation::Channel_A;
+					break;
+				default:
+					first = BakedAnimation::Channel_DarkR;
+					last = BakedAnimation::Channel_DarkB;
+			}
+			for (int channel = first; channel <= last; channel++) {
+				baked->_channels.add(channel);
+				baked->_channelIndices.add(index);
+			}
+		}
+	}
+
+	float duration = animation.getDuration();
+	size_t frameCount = duration > 0 ? (size_t) MathUtil::ceil(duration * frameRate) + 1 : 1;
+	baked->_frameCount = frameCount;
+	baked->_frameRate = frameCount > 1 ? (frameCount - 1) / duration : frameRate;
+
+	size_t channelCount = baked->_channels.size(), slotCount = attachmentTimelines.size();
+	baked->_values.ensureCapacity(frameCount * channelCount);
+	baked->_attachmentNames.ensureCapacity(frameCount * slotCount);
+	for (size_t frame = 0; frame < frameCount; frame++) {
+		float time = frameCount > 1 ? duration * frame / (frameCount - 1) : 0;
+		pose(animation, time);
+		for (size_t i = 0; i < channelCount; i++)
+			baked->_values.add(baked->getChannelValue(*_skeleton, i));
+		for (size_t i = 0; i < slotCount; i++)
+			baked->_attachmentNames.add(getAttachmentName(*attachmentTimelines[i], time));
+	}
+
+	// Measure the error of interpolating between the samples.
+	for (size_t frame = 0; frame + 1 < frameCount; frame++) {
+		float *from = baked->_values.buffer() + frame * channelCount, *to = from + channelCount;
+		for (int i = 1; i < ERROR_SAMPLES; i++) {
+			float percent = (float) i / ERROR_SAMPLES;
+			pose(animation, duration * (frame + percent) / (frameCount - 1));
+			for (size_t ii = 0; ii < channelCount; ii++) {
+				int channel = baked->_channels[ii];
+				bool rotate = channel == BakedAnimation::Channel_Rotate;
+				float error = baked->getChannelValue(*_skeleton, ii) - interpolate(from[ii], to[ii], percent, rotate);
+				if (rotate) error -= MathUtil::ceil(error / 360 - 0.5f) * 360;
+				baked->_maxErrors[channel] = MathUtil::max(baked->_maxErrors[channel], MathUtil::abs(error));
+			}
+		}
+	}
+	return baked;
+}
+
+void AnimationBaker::pose(Animation &animation, float time) {
+	_skeleton->setToSetupPose();
+	animation.apply(*_skeleton, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+}
+
+const String *AnimationBaker::getAttachmentName(AttachmentTimeline &timeline, float time) {
+	Vector<float> &frames = timeline.getFrames();
+	const String *name = time < frames[0] ? &_skeleton->getSlots()[timeline.getSlotIndex()]->getData().getAttachmentName()
+										  : &timeline.getAttachmentNames()[Animation::search(frames, time)];
+	return name->isEmpty() ? NULL : name;
+}
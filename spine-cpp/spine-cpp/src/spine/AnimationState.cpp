@@ -41,6 +41,8 @@
 #include <spine/SkeletonData.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
+#include <spine/Snapshot.h>
+#include <spine/TrackMask.h>
 
 #include <float.h>
 
@@ -60,7 +62,7 @@ TrackEntry::TrackEntry() : _animation(NULL), _previous(NULL), _next(NULL), _mixi
 						   _animationEnd(0), _animationLast(0), _nextAnimationLast(0), _delay(0), _trackTime(0),
 						   _trackLast(0), _nextTrackLast(0), _trackEnd(0), _timeScale(1.0f), _alpha(0), _mixTime(0),
 						   _mixDuration(0), _interruptAlpha(0), _totalAlpha(0), _mixBlend(MixBlend_Replace),
-						   _listener(dummyOnAnimationEventFunc), _listenerObject(NULL) {
+						   _mask(NULL), _maskVersion(0), _overriding(false), _overridden(false), _listener(dummyOnAnimationEventFunc), _listenerObject(NULL) {
 }
 
 TrackEntry::~TrackEntry() {}
@@ -176,6 +178,14 @@ void TrackEntry::setMixBlend(MixBlend blend) { _mixBlend = blend; }
 
 MixBlend TrackEntry::getMixBlend() { return _mixBlend; }
 
+TrackMask *TrackEntry::getMask() { return _mask; }
+
+void TrackEntry::setMask(TrackMask *mask) {
+	_mask = mask;
+	// Mask versions are never negative, so the next apply rebuilds the timeline modes and plan.
+	_maskVersion = -1;
+}
+
 void TrackEntry::resetRotationDirections() {
 	_timelinesRotation.clear();
 }
@@ -202,6 +212,10 @@ void TrackEntry::reset() {
 	_timelineMode.clear();
 	_timelineHoldMix.clear();
 	_timelinesRotation.clear();
+	_timelinePlan.clear();
+	_overridePlan.clear();
+	_overrideEntries.clear();
+	_mask = NULL;
 
 	_listener = dummyOnAnimationEventFunc;
 	_listenerObject = NULL;
@@ -333,7 +347,15 @@ AnimationState::AnimationState(AnimationStateData *data) : _data(data),
 														   _listenerObject(NULL),
 														   _unkeyedState(0),
 														   _timeScale(1),
-														   _manualTrackEntryDisposal(false) {
+														   _manualTrackEntryDisposal(false),
+														   _timelineCapacity(0) {
+	if (data->_skeletonData) {
+		Vector<Animation *> &animations = data->_skeletonData->getAnimations();
+		for (size_t i = 0, n = animations.size(); i < n; i++) {
+			size_t timelineCount = animations[i]->_timelines.size();
+			if (timelineCount > _timelineCapacity) _timelineCapacity = timelineCount;
+		}
+	}
 }
 
 AnimationState::~AnimationState() {
@@ -425,10 +447,25 @@ void AnimationState::update(float delta) {
 }
 
 bool AnimationState::apply(Skeleton &skeleton) {
+	// A changed mask of a current entry changes its plan.
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		TrackEntry *current = _tracks[i];
+		if (current != NULL && current->_maskVersion != (current->_mask != NULL ? current->_mask->_version : 0))
+			_animationsChanged = true;
+	}
 	if (_animationsChanged) {
 		animationsChanged();
 	}
 
+	// An entry overrides lower tracks only while it is applied alone with an alpha of 1.
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		TrackEntry *current = _tracks[i];
+		if (current == NULL) continue;
+		current->_overriding = current->_delay <= 0 && current->_mixingFrom == NULL && current->_alpha == 1 &&
+							   current->_mixBlend != MixBlend_Add &&
+							   !(current->_trackTime >= current->_trackEnd && current->_next == NULL);
+	}
+
 	bool applied = false;
 	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
 		TrackEntry *currentP = _tracks[i];
@@ -459,41 +496,54 @@ bool AnimationState::apply(Skeleton &skeleton) {
 			applyTime = current._animation->getDuration() - applyTime;
 			applyEvents = NULL;
 		}
-		size_t timelineCount = current._animation->_timelines.size();
-		Vector<Timeline *> &timelines = current._animation->_timelines;
-		if ((i == 0 && alpha == 1) || blend == MixBlend_Add) {
+		Vector<TrackEntry::TimelinePlan> *planP = &current._timelinePlan;
+		Vector<TrackEntry *> &overrideEntries = current._overrideEntries;
+		bool overridden = overrideEntries.size() > 0;
+		for (size_t ii = 0, nn = overrideEntries.size(); ii < nn; ++ii) {
+			if (!overrideEntries[ii]->_overriding) {
+				overridden = false;
+				break;
+			}
+		}
+		if (overridden)
+			planP = &current._overridePlan;
+		else if (current._overridden)
+			current._timelinesRotation.clear();// The dropped rotate timelines did not track their direction.
+		current._overridden = overridden;
+		Vector<TrackEntry::TimelinePlan> &plan = *planP;
+		size_t timelineCount = plan.size();
+		if ((i == 0 && alpha == 1 && current._mask == NULL) || blend == MixBlend_Add) {
 			if (i == 0) attachments = true;
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
-				Timeline *timeline = timelines[ii];
-				if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
-					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, blend,
+				TrackEntry::TimelinePlan &item = plan[ii];
+				if (item.kind == Kind_Attachment)
+					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(item.timeline), skeleton, applyTime, blend,
 											attachments);
 				else
-					timeline->apply(skeleton, animationLast, applyTime, applyEvents, alpha, blend, MixDirection_In);
+					item.timeline->apply(skeleton, animationLast, applyTime, applyEvents, alpha * item.weight, blend,
+										 MixDirection_In);
 			}
 		} else {
-			Vector<int> &timelineMode = current._timelineMode;
-
+			size_t rotationCount = current._animation->_timelines.size() << 1;
 			bool shortestRotation = current._shortestRotation;
-			bool firstFrame = !shortestRotation && current._timelinesRotation.size() != timelines.size() << 1;
-			if (firstFrame) current._timelinesRotation.setSize(timelines.size() << 1, 0);
+			bool firstFrame = !shortestRotation && current._timelinesRotation.size() != rotationCount;
+			if (firstFrame) current._timelinesRotation.setSize(rotationCount, 0);
 			Vector<float> &timelinesRotation = current._timelinesRotation;
 
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
-				Timeline *timeline = timelines[ii];
-				assert(timeline);
-
-				MixBlend timelineBlend = timelineMode[ii] == Subsequent ? blend : MixBlend_Setup;
-
-				if (!shortestRotation && timeline->getRTTI().isExactly(RotateTimeline::rtti))
-					applyRotateTimeline(static_cast<RotateTimeline *>(timeline), skeleton, applyTime, alpha,
-										timelineBlend, timelinesRotation, ii << 1, firstFrame);
-				else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
-					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime,
+				TrackEntry::TimelinePlan &item = plan[ii];
+				MixBlend timelineBlend = item.mode == Subsequent ? blend : MixBlend_Setup;
+
+				if (!shortestRotation && item.kind == Kind_Rotate)
+					applyRotateTimeline(static_cast<RotateTimeline *>(item.timeline), skeleton, applyTime,
+										alpha * item.weight, timelineBlend, timelinesRotation, item.index << 1,
+										firstFrame);
+				else if (item.kind == Kind_Attachment)
+					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(item.timeline), skeleton, applyTime,
 											blend, attachments);
 				else
-					timeline->apply(skeleton, animationLast, applyTime, applyEvents, alpha, timelineBlend,
-									MixDirection_In);
+					item.timeline->apply(skeleton, animationLast, applyTime, applyEvents, alpha * item.weight,
+										 timelineBlend, MixDirection_In);
 			}
 		}
 
@@ -731,6 +781,7 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 
 	Bone *bone = skeleton._bones[rotateTimeline->_boneIndex];
 	if (!bone->isActive()) return;
+	bone->_modified = true;
 	Vector<float> &frames = rotateTimeline->_frames;
 	float r1, r2;
 	if (time < frames[0]) {
@@ -832,8 +883,8 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 	}
 
 	bool attachments = mix < from->_mixAttachmentThreshold, drawOrder = mix < from->_mixDrawOrderThreshold;
-	Vector<Timeline *> &timelines = from->_animation->_timelines;
-	size_t timelineCount = timelines.size();
+	Vector<TrackEntry::TimelinePlan> &plan = from->_timelinePlan;
+	size_t timelineCount = plan.size();
 	float alphaHold = from->_alpha * to->_interruptAlpha, alphaMix = alphaHold * (1 - mix);
 	float animationLast = from->_animationLast, animationTime = from->getAnimationTime();
 	float applyTime = animationTime;
@@ -846,26 +897,25 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 
 	if (blend == MixBlend_Add) {
 		for (size_t i = 0; i < timelineCount; i++)
-			timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out);
+			plan[i].timeline->apply(skeleton, animationLast, applyTime, events, alphaMix * plan[i].weight, blend,
+									MixDirection_Out);
 	} else {
-		Vector<int> &timelineMode = from->_timelineMode;
-		Vector<TrackEntry *> &timelineHoldMix = from->_timelineHoldMix;
-
+		size_t rotationCount = from->_animation->_timelines.size() << 1;
 		bool shortestRotation = from->_shortestRotation;
-		bool firstFrame = !shortestRotation && from->_timelinesRotation.size() != timelines.size() << 1;
-		if (firstFrame) from->_timelinesRotation.setSize(timelines.size() << 1, 0);
+		bool firstFrame = !shortestRotation && from->_timelinesRotation.size() != rotationCount;
+		if (firstFrame) from->_timelinesRotation.setSize(rotationCount, 0);
 
 		Vector<float> &timelinesRotation = from->_timelinesRotation;
 
 		from->_totalAlpha = 0;
 		for (size_t i = 0; i < timelineCount; i++) {
-			Timeline *timeline = timelines[i];
+			TrackEntry::TimelinePlan &item = plan[i];
 			MixDirection direction = MixDirection_Out;
 			MixBlend timelineBlend;
 			float alpha;
-			switch (timelineMode[i]) {
+			switch (item.mode) {
 				case Subsequent:
-					if (!drawOrder && (timeline->getRTTI().isExactly(DrawOrderTimeline::rtti))) continue;
+					if (!drawOrder && item.kind == Kind_DrawOrder) continue;
 					timelineBlend = blend;
 					alpha = alphaMix;
 					break;
@@ -883,22 +933,22 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 					break;
 				default:
 					timelineBlend = MixBlend_Setup;
-					TrackEntry *holdMix = timelineHoldMix[i];
+					TrackEntry *holdMix = item.holdMix;
 					alpha = alphaHold * MathUtil::max(0.0f, 1.0f - holdMix->_mixTime / holdMix->_mixDuration);
 					break;
 			}
 			from->_totalAlpha += alpha;
-			if (!shortestRotation && (timeline->getRTTI().isExactly(RotateTimeline::rtti))) {
-				applyRotateTimeline((RotateTimeline *) timeline, skeleton, applyTime, alpha, timelineBlend,
-									timelinesRotation, i << 1, firstFrame);
-			} else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti)) {
-				applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, timelineBlend,
+			alpha *= item.weight;
+			if (!shortestRotation && item.kind == Kind_Rotate) {
+				applyRotateTimeline((RotateTimeline *) item.timeline, skeleton, applyTime, alpha, timelineBlend,
+									timelinesRotation, item.index << 1, firstFrame);
+			} else if (item.kind == Kind_Attachment) {
+				applyAttachmentTimeline(static_cast<AttachmentTimeline *>(item.timeline), skeleton, applyTime, timelineBlend,
 										attachments && alpha >= from->_alphaAttachmentThreshold);
 			} else {
-				if (drawOrder && timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) &&
-					timelineBlend == MixBlend_Setup)
+				if (drawOrder && item.kind == Kind_DrawOrder && timelineBlend == MixBlend_Setup)
 					direction = MixDirection_In;
-				timeline->apply(skeleton, animationLast, applyTime, events, alpha, timelineBlend, direction);
+				item.timeline->apply(skeleton, animationLast, applyTime, events, alpha, timelineBlend, direction);
 			}
 		}
 	}
@@ -990,6 +1040,15 @@ TrackEntry *AnimationState::newTrackEntry(size_t trackIndex, Animation *animatio
 	TrackEntry *entryP = _trackEntryPool.obtain();// Pooling
 	TrackEntry &entry = *entryP;
 
+	// Size the per timeline data for the largest animation, so pooled entries do not grow when switching animations.
+	if (animation->_timelines.size() > _timelineCapacity) _timelineCapacity = animation->_timelines.size();
+	entry._timelineMode.ensureCapacity(_timelineCapacity);
+	entry._timelineHoldMix.ensureCapacity(_timelineCapacity);
+	entry._timelinePlan.ensureCapacity(_timelineCapacity);
+	entry._overridePlan.ensureCapacity(_timelineCapacity);
+	entry._overrideEntries.ensureCapacity(_tracks.size());
+	entry._timelinesRotation.ensureCapacity(_timelineCapacity << 1);
+
 	entry._trackIndex = (int) trackIndex;
 	entry._animation = animation;
 	entry._loop = loop;
@@ -1021,6 +1080,9 @@ TrackEntry *AnimationState::newTrackEntry(size_t trackIndex, Animation *animatio
 	entry._interruptAlpha = 1;
 	entry._totalAlpha = 0;
 	entry._mixBlend = MixBlend_Replace;
+	entry._mask = NULL;
+	entry._overriding = false;
+	entry._overridden = false;
 
 	return entryP;
 }
@@ -1048,9 +1110,12 @@ void AnimationState::animationsChanged() {
 
 		do {
 			if (entry->_mixingTo == NULL || entry->_mixBlend != MixBlend_Add) computeHold(entry);
+			buildTimelinePlan(entry);
 			entry = entry->_mixingTo;
 		} while (entry != NULL);
 	}
+
+	computeOverrides();
 }
 
 void AnimationState::computeHold(TrackEntry *entry) {
@@ -1062,8 +1127,15 @@ void AnimationState::computeHold(TrackEntry *entry) {
 	Vector<TrackEntry *> &timelineHoldMix = entry->_timelineHoldMix;
 	timelineHoldMix.setSize(timelinesCount, 0);
 
+	// Timelines masked out are not applied, so their properties are left for the next entry to set first.
+	TrackMask *mask = entry->_mask;
+
 	if (to != NULL && to->_holdPrevious) {
 		for (size_t i = 0; i < timelinesCount; i++) {
+			if (mask != NULL && mask->getTimelineWeight(*timelines[i]) == 0) {
+				timelineMode[i] = First;
+				continue;
+			}
 			timelineMode[i] = _propertyIDs.addAll(timelines[i]->getPropertyIds(), true) ? HoldFirst : HoldSubsequent;
 		}
 		return;
@@ -1074,6 +1146,10 @@ void AnimationState::computeHold(TrackEntry *entry) {
 continue_outer:
 	for (; i < timelinesCount; ++i) {
 		Timeline *timeline = timelines[i];
+		if (mask != NULL && mask->getTimelineWeight(*timeline) == 0) {
+			timelineMode[i] = First;
+			continue;
+		}
 		Vector<PropertyId> &ids = timeline->getPropertyIds();
 		if (!_propertyIDs.addAll(ids, true)) {
 			timelineMode[i] = Subsequent;
@@ -1098,3 +1174,283 @@ continue_outer:
 		}
 	}
 }
+
+void AnimationState::buildTimelinePlan(TrackEntry *entry) {
+	Vector<Timeline *> &timelines = entry->_animation->_timelines;
+	size_t timelinesCount = timelines.size();
+	// Entries mixing to an additive entry have no modes, they are applied without them.
+	bool modes = entry->_timelineMode.size() == timelinesCount;
+	TrackMask *mask = entry->_mask;
+	entry->_maskVersion = mask != NULL ? mask->_version : 0;
+	Vector<TrackEntry::TimelinePlan> &plan = entry->_timelinePlan;
+	plan.clear();
+	plan.ensureCapacity(timelinesCount);
+	for (size_t i = 0; i < timelinesCount; i++) {
+		Timeline *timeline = timelines[i];
+		TrackEntry::TimelinePlan item;
+		item.weight = mask != NULL ? mask->getTimelineWeight(*timeline) : 1;
+		if (item.weight == 0) continue;
+		item.timeline = timeline;
+		const RTTI &rtti = timeline->getRTTI();
+		if (rtti.isExactly(RotateTimeline::rtti))
+			item.kind = Kind_Rotate;
+		else if (rtti.isExactly(AttachmentTimeline::rtti))
+			item.kind = Kind_Attachment;
+		else if (rtti.isExactly(DrawOrderTimeline::rtti))
+			item.kind = Kind_DrawOrder;
+		else {
+			// Bone transform and color timelines set the property fully when applied with an alpha of 1.
+			switch ((int) (timeline->getPropertyIds()[0] >> 32)) {
+				case Property_X:
+				case Property_Y:
+				case Property_ScaleX:
+				case Property_ScaleY:
+				case Property_ShearX:
+				case Property_ShearY:
+				case Property_Rgb:
+				case Property_Alpha:
+				case Property_Rgb2:
+					item.kind = Kind_Curve;
+					break;
+				default:
+					item.kind = Kind_Timeline;
+			}
+		}
+		item.mode = modes ? entry->_timelineMode[i] : First;
+		item.holdMix = modes ? entry->_timelineHoldMix[i] : NULL;
+		item.index = i;
+		plan.add(item);
+	}
+}
+
+void AnimationState::computeOverrides() {
+	// Timelines of current entries are dropped while higher tracks replace all of their properties.
+	_overrideIds.clear();
+	for (size_t i = _tracks.size(); i > 0; --i) {
+		TrackEntry *entry = _tracks[i - 1];
+		if (entry != NULL) computeOverrides(entry);
+	}
+}
+
+void AnimationState::computeOverrides(TrackEntry *entry) {
+	Vector<TrackEntry::TimelinePlan> &plan = entry->_timelinePlan;
+	Vector<TrackEntry::TimelinePlan> &overridePlan = entry->_overridePlan;
+	Vector<TrackEntry *> &overrideEntries = entry->_overrideEntries;
+	overridePlan.clear();
+	overrideEntries.clear();
+	if (_overrideIds.size() > 0) {
+		for (size_t i = 0, n = plan.size(); i < n; i++) {
+			TrackEntry::TimelinePlan &item = plan[i];
+			if (item.kind == Kind_Curve || item.kind == Kind_Rotate) {
+				Vector<PropertyId> &ids = item.timeline->getPropertyIds();
+				size_t ii = 0, nn = ids.size();
+				for (; ii < nn; ii++)
+					if (!_overrideIds.containsKey(ids[ii])) break;
+				if (ii == nn) {
+					for (ii = 0; ii < nn; ii++) {
+						TrackEntry *by = _overrideIds.get(ids[ii], NULL);
+						if (!overrideEntries.contains(by)) overrideEntries.add(by);
+					}
+					continue;
+				}
+			}
+			overridePlan.add(plan[i]);
+		}
+		if (overrideEntries.size() == 0) overridePlan.clear();
+	}
+
+	// Additive entries and timelines keyed after the animation start do not replace the lower tracks' pose.
+	if (entry->_mixBlend == MixBlend_Add) return;
+	for (size_t i = 0, n = plan.size(); i < n; i++) {
+		TrackEntry::TimelinePlan &item = plan[i];
+		if ((item.kind != Kind_Curve && item.kind != Kind_Rotate) || item.weight != 1) continue;
+		if (item.timeline->getFrames()[0] > 0) continue;
+		Vector<PropertyId> &ids = item.timeline->getPropertyIds();
+		for (size_t ii = 0, nn = ids.size(); ii < nn; ii++)
+			_overrideIds.put(ids[ii], entry);
+	}
+}
+
+size_t AnimationState::getSnapshotSize() {
+	collectSnapshotEntries();
+	SnapshotWriter writer(NULL, 0);
+	SnapshotHeader header = SnapshotHeader();
+	writer.value(header);
+	snapshot(writer);
+	return writer.getSize();
+}
+
+size_t AnimationState::writeSnapshot(void *buffer, size_t size) {
+	collectSnapshotEntries();
+	SnapshotWriter writer(buffer, size);
+	SnapshotHeader header = {SnapshotHeader::MAGIC, SnapshotHeader::VERSION, SnapshotHeader::Type_AnimationState, 0, _data};
+	writer.value(header);
+	snapshot(writer);
+	_snapshotEntries.clear();
+	if (!writer.isValid()) return 0;
+	header.size = (uint32_t) writer.getSize();
+	memcpy(buffer, &header, sizeof(SnapshotHeader));
+	return writer.getSize();
+}
+
+bool AnimationState::readSnapshot(const void *buffer, size_t size) {
+	SnapshotHeader header;
+	if (!SnapshotHeader::read(buffer, size, SnapshotHeader::Type_AnimationState, _data, header)) return false;
+	// Checks the whole snapshot first, so a truncated snapshot leaves the track entries unchanged.
+	SnapshotValidator validator(buffer, header.size);
+	validator.value(header);
+	snapshot(validator);
+	if (!validator.isValid()) return false;
+	SnapshotReader reader(buffer, header.size);
+	reader.value(header);
+	snapshot(reader);
+	_snapshotEntries.clear();
+	return reader.isValid();
+}
+
+void AnimationState::collectSnapshotEntries() {
+	Vector<TrackEntry *> &entries = _snapshotEntries;
+	entries.clear();
+	for (size_t i = 0, n = _tracks.size(); i < n; i++)
+		if (_tracks[i] && !entries.contains(_tracks[i])) entries.add(_tracks[i]);
+	for (size_t i = 0; i < entries.size(); i++) {
+		TrackEntry *entry = entries[i];
+		TrackEntry *links[] = {entry->_previous, entry->_next, entry->_mixingFrom, entry->_mixingTo};
+		for (int ii = 0; ii < 4; ii++)
+			if (links[ii] && !entries.contains(links[ii])) entries.add(links[ii]);
+	}
+}
+
+void AnimationState::snapshotEntries(SnapshotWriter &writer) {
+	size_t count = _snapshotEntries.size();
+	writer.count(count, sizeof(int));
+}
+
+void AnimationState::snapshotEntries(SnapshotReader &reader) {
+	size_t count = 0;
+	reader.count(count, sizeof(int));
+	if (!reader.isValid()) return;
+
+	collectSnapshotEntries();
+	for (size_t i = 0, n = _snapshotEntries.size(); i < n; i++) {
+		TrackEntry *entry = _snapshotEntries[i];
+		entry->reset();
+		_trackEntryPool.free(entry);
+	}
+	_snapshotEntries.clear();
+	_tracks.clear();
+	for (size_t i = 0; i < count; i++) {
+		TrackEntry *entry = _trackEntryPool.obtain();
+		entry->reset();
+		_snapshotEntries.add(entry);
+	}
+}
+
+void AnimationState::snapshotLink(SnapshotWriter &writer, TrackEntry *&entry) {
+	int id = entry ? _snapshotEntries.indexOf(entry) : -1;
+	writer.value(id);
+}
+
+void AnimationState::snapshotLink(SnapshotReader &reader, TrackEntry *&entry) {
+	int id = -1;
+	reader.value(id);
+	entry = id >= 0 && id < (int) _snapshotEntries.size() ? _snapshotEntries[id] : NULL;
+}
+
+void AnimationState::snapshotLink(SnapshotValidator &validator, TrackEntry *&entry) {
+	int id = -1;
+	validator.value(id);
+	SP_UNUSED(entry);
+}
+
+void AnimationState::snapshotLinks(SnapshotWriter &writer, Vector<TrackEntry *> &entries) {
+	size_t count = entries.size();
+	writer.count(count, sizeof(int));
+	for (size_t i = 0; i < count; i++)
+		snapshotLink(writer, entries[i]);
+}
+
+void AnimationState::snapshotLinks(SnapshotReader &reader, Vector<TrackEntry *> &entries) {
+	size_t count = 0;
+	reader.count(count, sizeof(int));
+	entries.setSize(count, NULL);
+	for (size_t i = 0; i < count; i++)
+		snapshotLink(reader, entries[i]);
+}
+
+void AnimationState::snapshotLinks(SnapshotValidator &validator, Vector<TrackEntry *> &entries) {
+	SP_UNUSED(entries);
+	size_t count = 0;
+	validator.count(count, sizeof(int));
+	validator.values((int *) NULL, count);
+}
+
+template<typename T>
+void AnimationState::snapshot(T &archive) {
+	archive.value(_timeScale);
+	archive.value(_unkeyedState);
+	archive.value(_animationsChanged);
+
+	snapshotEntries(archive);
+	snapshotLinks(archive, _tracks);
+	for (size_t i = 0, n = _snapshotEntries.size(); i < n; i++)
+		snapshotEntry(archive, *_snapshotEntries[i]);
+	if (archive.isReading() && archive.isValid()) computeOverrides();
+}
+
+void AnimationState::snapshot(SnapshotValidator &validator) {
+	validator.value(_timeScale);
+	validator.value(_unkeyedState);
+	validator.value(_animationsChanged);
+
+	size_t count = 0;
+	validator.count(count, sizeof(int));
+	snapshotLinks(validator, _tracks);
+	TrackEntry entry;
+	for (size_t i = 0; i < count && validator.isValid(); i++)
+		snapshotEntry(validator, entry);
+}
+
+template<typename T>
+void AnimationState::snapshotEntry(T &archive, TrackEntry &entry) {
+	archive.value(entry._animation);
+	snapshotLink(archive, entry._previous);
+	snapshotLink(archive, entry._next);
+	snapshotLink(archive, entry._mixingFrom);
+	snapshotLink(archive, entry._mixingTo);
+	archive.value(entry._trackIndex);
+	archive.value(entry._loop);
+	archive.value(entry._holdPrevious);
+	archive.value(entry._reverse);
+	archive.value(entry._shortestRotation);
+	archive.value(entry._eventThreshold);
+	archive.value(entry._mixAttachmentThreshold);
+	archive.value(entry._alphaAttachmentThreshold);
+	archive.value(entry._mixDrawOrderThreshold);
+	archive.value(entry._animationStart);
+	archive.value(entry._animationEnd);
+	archive.value(entry._animationLast);
+	archive.value(entry._nextAnimationLast);
+	archive.value(entry._delay);
+	archive.value(entry._trackTime);
+	archive.value(entry._trackLast);
+	archive.value(entry._nextTrackLast);
+	archive.value(entry._trackEnd);
+	archive.value(entry._timeScale);
+	archive.value(entry._alpha);
+	archive.value(entry._mixTime);
+	archive.value(entry._mixDuration);
+	archive.value(entry._interruptAlpha);
+	archive.value(entry._totalAlpha);
+	archive.value(entry._mixBlend);
+	archive.value(entry._mask);
+	archive.value(entry._overridden);
+#ifndef SPINE_USE_STD_FUNCTION
+	archive.value(entry._listener);
+#endif
+	archive.value(entry._listenerObject);
+	archive.vector(entry._timelineMode);
+	snapshotLinks(archive, entry._timelineHoldMix);
+	archive.vector(entry._timelinesRotation);
+	if (archive.isReading() && archive.isValid()) buildTimelinePlan(&entry);
+}
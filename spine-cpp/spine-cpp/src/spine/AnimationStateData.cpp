@@ -31,9 +31,15 @@
 #include <spine/Animation.h>
 #include <spine/SkeletonData.h>
 
+#include <float.h>
+
 using namespace spine;
 
-AnimationStateData::AnimationStateData(SkeletonData *skeletonData) : _skeletonData(skeletonData), _defaultMix(0) {
+/// Marks matrix entries without a mix duration.
+static const float NO_MIX = -FLT_MAX;
+
+AnimationStateData::AnimationStateData(SkeletonData *skeletonData) : _skeletonData(skeletonData), _defaultMix(0),
+																	 _mixMatrixEnabled(false), _mixMatrixSize(0) {
 }
 
 void AnimationStateData::setMix(const String &fromName, const String &toName, float duration) {
@@ -49,16 +55,23 @@ void AnimationStateData::setMix(Animation *from, Animation *to, float duration)
 
 	AnimationPair key(from, to);
 	_animationToMixTime.put(key, duration);
+	if (_mixMatrixEnabled) setMatrixMix(from, to, duration);
 }
 
 float AnimationStateData::getMix(Animation *from, Animation *to) {
 	assert(from != NULL);
 	assert(to != NULL);
 
-	AnimationPair key(from, to);
+	if (_mixMatrixEnabled) {
+		int fromIndex = getMatrixIndex(from), toIndex = getMatrixIndex(to);
+		if (fromIndex != -1 && toIndex != -1) {
+			float mix = _mixMatrix[fromIndex * _mixMatrixSize + toIndex];
+			return mix == NO_MIX ? _defaultMix : mix;
+		}
+	}
 
-	if (_animationToMixTime.containsKey(key)) return _animationToMixTime[key];
-	return _defaultMix;
+	AnimationPair key(from, to);
+	return _animationToMixTime.get(key, _defaultMix);
 }
 
 SkeletonData *AnimationStateData::getSkeletonData() {
@@ -76,6 +89,45 @@ void AnimationStateData::setDefaultMix(float inValue) {
 void AnimationStateData::clear() {
 	_defaultMix = 0;
 	_animationToMixTime.clear();
+	for (size_t i = 0, n = _mixMatrix.size(); i < n; i++)
+		_mixMatrix[i] = NO_MIX;
+}
+
+void AnimationStateData::setMixMatrixEnabled(bool enabled) {
+	_mixMatrixEnabled = enabled;
+	_mixMatrix.clear();
+	if (!enabled) {
+		_mixMatrixSize = 0;
+		_mixMatrix.shrinkToFit();
+		return;
+	}
+	_mixMatrixSize = _skeletonData->getAnimations().size();
+	_mixMatrix.ensureCapacity(_mixMatrixSize * _mixMatrixSize);
+	_mixMatrix.setSize(_mixMatrixSize * _mixMatrixSize, NO_MIX);
+	HashMap<AnimationPair, float>::Entries entries = _animationToMixTime.getEntries();
+	while (entries.hasNext()) {
+		HashMap<AnimationPair, float>::Pair pair = entries.next();
+		setMatrixMix(pair.key._a1, pair.key._a2, pair.value);
+	}
+}
+
+bool AnimationStateData::isMixMatrixEnabled() {
+	return _mixMatrixEnabled;
+}
+
+int AnimationStateData::getMatrixIndex(Animation *animation) {
+	int index = animation->_index;
+	if (index < 0 || index >= (int) _mixMatrixSize || _skeletonData->getAnimations()[index] != animation) return -1;
+	return index;
+}
+
+void AnimationStateData::setMatrixMix(Animation *from, Animation *to, float duration) {
+	// Mixes are matched by animation name, so they apply to the skeleton data's animations with the same names.
+	from = _skeletonData->findAnimation(from->getName());
+	to = _skeletonData->findAnimation(to->getName());
+	if (from == NULL || to == NULL) return;
+	int fromIndex = getMatrixIndex(from), toIndex = getMatrixIndex(to);
+	if (fromIndex != -1 && toIndex != -1) _mixMatrix[fromIndex * _mixMatrixSize + toIndex] = duration;
 }
 
 AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) : _a1(a1), _a2(a2) {
@@ -84,3 +136,16 @@ AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) :
 bool AnimationStateData::AnimationPair::operator==(const AnimationPair &other) const {
 	return _a1->_name == other._a1->_name && _a2->_name == other._a2->_name;
 }
+
+size_t AnimationStateData::AnimationPair::hash() const {
+	// FNV-1a of both names, consistent with operator== comparing the names.
+	size_t hash = 2166136261u;
+	const String *names[] = {&_a1->_name, &_a2->_name};
+	for (int i = 0; i < 2; i++) {
+		const char *chars = names[i]->buffer();
+		for (size_t ii = 0, n = names[i]->length(); ii < n; ii++)
+			hash = (hash ^ (unsigned char) chars[ii]) * 16777619u;
+		hash = (hash ^ 0xff) * 16777619u;
+	}
+	return hash;
+}
@@ -72,12 +72,25 @@ Bone::Bone(BoneData &data, Skeleton &skeleton, Bone *parent) : Updatable(),
 															   _worldY(0),
 															   _sorted(false),
 															   _active(false),
+															   _modified(true),
+															   _constrained(false),
+															   _recomputed(true),
 															   _inherit(Inherit_Normal) {
 	setToSetupPose();
 }
 
 void Bone::update(Physics) {
+	if (_skeleton._incrementalUpdate && !_modified && !_constrained &&
+		(!_parent || (!_parent->_recomputed && !_parent->_constrained))) {
+		// Nothing this bone's world transform depends on was set since the previous update.
+		_recomputed = false;
+		_skeleton._skippedBones++;
+		return;
+	}
 	updateWorldTransform(_ax, _ay, _arotation, _ascaleX, _ascaleY, _ashearX, _ashearY);
+	_modified = false;
+	_recomputed = true;
+	_skeleton._recomputedBones++;
 }
 
 void Bone::updateWorldTransform() {
@@ -88,6 +101,7 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 	float pa, pb, pc, pd;
 	Bone *parent = _parent;
 
+	_modified = true;
 	_ax = x;
 	_ay = y;
 	_arotation = rotation;
@@ -215,6 +229,7 @@ void Bone::setToSetupPose() {
 	_shearX = data.getShearX();
 	_shearY = data.getShearY();
 	_inherit = data.getInherit();
+	_modified = true;
 }
 
 void Bone::worldToLocal(float worldX, float worldY, float &outLocalX, float &outLocalY) {
@@ -274,6 +289,7 @@ void Bone::rotateWorld(float degrees) {
 	_b = cosine * rb - sine * _d;
 	_c = sine * ra + cosine * _c;
 	_d = sine * rb + cosine * _d;
+	_modified = true;
 }
 
 float Bone::getWorldToLocalRotationX() {
@@ -330,6 +346,7 @@ float Bone::getX() {
 
 void Bone::setX(float inValue) {
 	_x = inValue;
+	_modified = true;
 }
 
 float Bone::getY() {
@@ -338,6 +355,7 @@ float Bone::getY() {
 
 void Bone::setY(float inValue) {
 	_y = inValue;
+	_modified = true;
 }
 
 float Bone::getRotation() {
@@ -346,6 +364,7 @@ float Bone::getRotation() {
 
 void Bone::setRotation(float inValue) {
 	_rotation = inValue;
+	_modified = true;
 }
 
 float Bone::getScaleX() {
@@ -354,6 +373,7 @@ float Bone::getScaleX() {
 
 void Bone::setScaleX(float inValue) {
 	_scaleX = inValue;
+	_modified = true;
 }
 
 float Bone::getScaleY() {
@@ -362,6 +382,7 @@ float Bone::getScaleY() {
 
 void Bone::setScaleY(float inValue) {
 	_scaleY = inValue;
+	_modified = true;
 }
 
 float Bone::getShearX() {
@@ -370,6 +391,7 @@ float Bone::getShearX() {
 
 void Bone::setShearX(float inValue) {
 	_shearX = inValue;
+	_modified = true;
 }
 
 float Bone::getShearY() {
@@ -378,6 +400,7 @@ float Bone::getShearY() {
 
 void Bone::setShearY(float inValue) {
 	_shearY = inValue;
+	_modified = true;
 }
 
 float Bone::getAppliedRotation() {
@@ -386,6 +409,7 @@ float Bone::getAppliedRotation() {
 
 void Bone::setAppliedRotation(float inValue) {
 	_arotation = inValue;
+	_modified = true;
 }
 
 float Bone::getAX() {
@@ -394,6 +418,7 @@ float Bone::getAX() {
 
 void Bone::setAX(float inValue) {
 	_ax = inValue;
+	_modified = true;
 }
 
 float Bone::getAY() {
@@ -402,6 +427,7 @@ float Bone::getAY() {
 
 void Bone::setAY(float inValue) {
 	_ay = inValue;
+	_modified = true;
 }
 
 float Bone::getAScaleX() {
@@ -410,6 +436,7 @@ float Bone::getAScaleX() {
 
 void Bone::setAScaleX(float inValue) {
 	_ascaleX = inValue;
+	_modified = true;
 }
 
 float Bone::getAScaleY() {
@@ -418,6 +445,7 @@ float Bone::getAScaleY() {
 
 void Bone::setAScaleY(float inValue) {
 	_ascaleY = inValue;
+	_modified = true;
 }
 
 float Bone::getAShearX() {
@@ -426,6 +454,7 @@ float Bone::getAShearX() {
 
 void Bone::setAShearX(float inValue) {
 	_ashearX = inValue;
+	_modified = true;
 }
 
 float Bone::getAShearY() {
@@ -434,6 +463,7 @@ float Bone::getAShearY() {
 
 void Bone::setAShearY(float inValue) {
 	_ashearY = inValue;
+	_modified = true;
 }
 
 float Bone::getA() {
@@ -442,6 +472,7 @@ float Bone::getA() {
 
 void Bone::setA(float inValue) {
 	_a = inValue;
+	_modified = true;
 }
 
 float Bone::getB() {
@@ -450,6 +481,7 @@ float Bone::getB() {
 
 void Bone::setB(float inValue) {
 	_b = inValue;
+	_modified = true;
 }
 
 float Bone::getC() {
@@ -458,6 +490,7 @@ float Bone::getC() {
 
 void Bone::setC(float inValue) {
 	_c = inValue;
+	_modified = true;
 }
 
 float Bone::getD() {
@@ -466,6 +499,7 @@ float Bone::getD() {
 
 void Bone::setD(float inValue) {
 	_d = inValue;
+	_modified = true;
 }
 
 float Bone::getWorldX() {
@@ -474,6 +508,7 @@ float Bone::getWorldX() {
 
 void Bone::setWorldX(float inValue) {
 	_worldX = inValue;
+	_modified = true;
 }
 
 float Bone::getWorldY() {
@@ -482,6 +517,7 @@ float Bone::getWorldY() {
 
 void Bone::setWorldY(float inValue) {
 	_worldY = inValue;
+	_modified = true;
 }
 
 float Bone::getWorldRotationX() {
@@ -103,13 +103,12 @@ void RGBATimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 			break;
 		}
 		default: {
-			r = getBezierValue(time, i, RGBATimeline::R, curveType - RGBATimeline::BEZIER);
-			g = getBezierValue(time, i, RGBATimeline::G,
-							   curveType + RGBATimeline::BEZIER_SIZE - RGBATimeline::BEZIER);
-			b = getBezierValue(time, i, RGBATimeline::B,
-							   curveType + RGBATimeline::BEZIER_SIZE * 2 - RGBATimeline::BEZIER);
-			a = getBezierValue(time, i, RGBATimeline::A,
-							   curveType + RGBATimeline::BEZIER_SIZE * 3 - RGBATimeline::BEZIER);
+			float values[4];
+			getBezierValues(time, i, curveType - RGBATimeline::BEZIER, values, 4);
+			r = values[0];
+			g = values[1];
+			b = values[2];
+			a = values[3];
 		}
 	}
 	Color &color = slot->_color;
@@ -189,11 +188,11 @@ void RGBTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<E
 			break;
 		}
 		default: {
-			r = getBezierValue(time, i, RGBTimeline::R, curveType - RGBTimeline::BEZIER);
-			g = getBezierValue(time, i, RGBTimeline::G,
-							   curveType + RGBTimeline::BEZIER_SIZE - RGBTimeline::BEZIER);
-			b = getBezierValue(time, i, RGBTimeline::B,
-							   curveType + RGBTimeline::BEZIER_SIZE * 2 - RGBTimeline::BEZIER);
+			float values[3];
+			getBezierValues(time, i, curveType - RGBTimeline::BEZIER, values, 3);
+			r = values[0];
+			g = values[1];
+			b = values[2];
 		}
 	}
 	Color &color = slot->_color;
@@ -336,19 +335,15 @@ void RGBA2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 			break;
 		}
 		default: {
-			r = getBezierValue(time, i, RGBA2Timeline::R, curveType - RGBA2Timeline::BEZIER);
-			g = getBezierValue(time, i, RGBA2Timeline::G,
-							   curveType + RGBA2Timeline::BEZIER_SIZE - RGBA2Timeline::BEZIER);
-			b = getBezierValue(time, i, RGBA2Timeline::B,
-							   curveType + RGBA2Timeline::BEZIER_SIZE * 2 - RGBA2Timeline::BEZIER);
-			a = getBezierValue(time, i, RGBA2Timeline::A,
-							   curveType + RGBA2Timeline::BEZIER_SIZE * 3 - RGBA2Timeline::BEZIER);
-			r2 = getBezierValue(time, i, RGBA2Timeline::R2,
-								curveType + RGBA2Timeline::BEZIER_SIZE * 4 - RGBA2Timeline::BEZIER);
-			g2 = getBezierValue(time, i, RGBA2Timeline::G2,
-								curveType + RGBA2Timeline::BEZIER_SIZE * 5 - RGBA2Timeline::BEZIER);
-			b2 = getBezierValue(time, i, RGBA2Timeline::B2,
-								curveType + RGBA2Timeline::BEZIER_SIZE * 6 - RGBA2Timeline::BEZIER);
+			float values[7];
+			getBezierValues(time, i, curveType - RGBA2Timeline::BEZIER, values, 7);
+			r = values[0];
+			g = values[1];
+			b = values[2];
+			a = values[3];
+			r2 = values[4];
+			g2 = values[5];
+			b2 = values[6];
 		}
 	}
 	Color &light = slot->_color, &dark = slot->_darkColor;
@@ -452,11 +447,11 @@ void RGB2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 			break;
 		}
 		default: {
-			r = getBezierValue(time, i, RGB2Timeline::R, curveType - RGB2Timeline::BEZIER);
-			g = getBezierValue(time, i, RGB2Timeline::G,
-							   curveType + RGB2Timeline::BEZIER_SIZE - RGB2Timeline::BEZIER);
-			b = getBezierValue(time, i, RGB2Timeline::B,
-							   curveType + RGB2Timeline::BEZIER_SIZE * 2 - RGB2Timeline::BEZIER);
+			float values[3];
+			getBezierValues(time, i, curveType - RGB2Timeline::BEZIER, values, 3);
+			r = values[0];
+			g = values[1];
+			b = values[2];
 			r2 = getBezierValue(time, i, RGB2Timeline::R2,
 								curveType + RGB2Timeline::BEZIER_SIZE * 4 - RGB2Timeline::BEZIER);
 			g2 = getBezierValue(time, i, RGB2Timeline::G2,
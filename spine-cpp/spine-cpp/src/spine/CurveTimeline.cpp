@@ -29,16 +29,72 @@
 
 #include <spine/CurveTimeline.h>
 
+#include <spine/Animation.h>
 #include <spine/MathUtil.h>
 
+#include <float.h>
+
 using namespace spine;
 
+/// The largest quantized value.
+static const float QUANTIZED_MAX = 65535;
+
+/// Computes the 9 points (18 floats) a bezier is approximated with, the same as CurveTimeline::setBezier().
+static void sampleBezier(float *samples, float time1, float value1, float cx1, float cy1, float cx2, float cy2,
+						 float time2, float value2) {
+	float tmpx = (time1 - cx1 * 2 + cx2) * 0.03, tmpy = (value1 - cy1 * 2 + cy2) * 0.03;
+	float dddx = ((cx1 - cx2) * 3 - time1 + time2) * 0.006, dddy = ((cy1 - cy2) * 3 - value1 + value2) * 0.006;
+	float ddx = tmpx * 2 + dddx, ddy = tmpy * 2 + dddy;
+	float dx = (cx1 - time1) * 0.3 + tmpx + dddx * 0.16666667, dy = (cy1 - value1) * 0.3 + tmpy + dddy * 0.16666667;
+	float x = time1 + dx, y = value1 + dy;
+	for (int i = 0; i < 18; i += 2) {
+		samples[i] = x;
+		samples[i + 1] = y;
+		dx += ddx;
+		dy += ddy;
+		ddx += dddx;
+		ddy += dddy;
+		x += dx;
+		y += dy;
+	}
+}
+
+/// Computes the control points of a bezier from the 9 points sampleBezier() computed for it, with a least squares fit of
+/// the points at t = 0.1, 0.2, ..., 0.9.
+static void fitBezier(const float *samples, int offset, float start, float end, float &c1, float &c2) {
+	double aa = 0, ab = 0, bb = 0, ar = 0, br = 0;
+	for (int i = 1; i <= 9; i++) {
+		double t = i * 0.1, u = 1 - t;
+		double a = 3 * u * u * t, b = 3 * u * t * t;
+		double r = samples[(i - 1) * 2 + offset] - u * u * u * start - t * t * t * end;
+		aa += a * a;
+		ab += a * b;
+		bb += b * b;
+		ar += a * r;
+		br += b * r;
+	}
+	double determinant = aa * bb - ab * ab;
+	c1 = (float) ((ar * bb - br * ab) / determinant);
+	c2 = (float) ((aa * br - ab * ar) / determinant);
+}
+
+static unsigned short quantizeValue(float value, float offset, float scale) {
+	if (scale == 0) return 0;
+	return (unsigned short) MathUtil::clamp((float) (int) ((value - offset) / scale + 0.5f), 0, QUANTIZED_MAX);
+}
+
 RTTI_IMPL(CurveTimeline, Timeline)
 
+/// The number of equal time buckets a bezier's lookup has.
+static const int BEZIER_LOOKUP_SIZE = 16;
+
 CurveTimeline::CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount) : Timeline(frameCount,
-																									frameEntries) {
+																									frameEntries),
+																						   _bezierStart(frameCount) {
 	_curves.setSize(frameCount + bezierCount * BEZIER_SIZE, 0);
 	_curves[frameCount - 1] = STEPPED;
+	_bezierTimes.setSize(bezierCount << 1, 0);
+	_bezierSegments.setSize(bezierCount * BEZIER_LOOKUP_SIZE, 0);
 }
 
 CurveTimeline::~CurveTimeline() {
@@ -71,54 +127,133 @@ void CurveTimeline::setBezier(size_t bezier, size_t frame, float value, float ti
 		x += dx;
 		y += dy;
 	}
+	setBezierLookup(bezier, time1, time2);
+}
+
+/// Returns the segment of a bezier's samples the time is in, searching from a segment no time before the time can be in.
+static size_t findBezierSegment(const float *curves, float time, size_t segment = 0) {
+	if (segment == 0) {
+		if (curves[0] > time) return 0;
+		segment = 1;
+	}
+	for (; segment < 9; segment++)
+		if (curves[segment << 1] >= time) return segment;
+	return 9;
+}
+
+/// Returns the lookup bucket of a time. Never decreases for increasing times, so a sample in an earlier bucket than a time is
+/// before that time.
+static int getBezierBucket(float time, float time1, float scale) {
+	float bucket = (time - time1) * scale;
+	if (bucket <= 0) return 0;
+	if (bucket >= BEZIER_LOOKUP_SIZE - 1) return BEZIER_LOOKUP_SIZE - 1;
+	return (int) bucket;
+}
+
+void CurveTimeline::setBezierLookup(size_t bezier, float time1, float time2) {
+	const float *curves = _curves.buffer() + _bezierStart + bezier * BEZIER_SIZE;
+	float scale = time2 > time1 ? BEZIER_LOOKUP_SIZE / (time2 - time1) : 0;
+	_bezierTimes[bezier << 1] = time1;
+	_bezierTimes[(bezier << 1) + 1] = scale;
+	unsigned char *segments = _bezierSegments.buffer() + bezier * BEZIER_LOOKUP_SIZE;
+	// The first sample in or after a bucket starts the first segment a time in that bucket can be in.
+	size_t sample = 0;
+	for (int bucket = 0; bucket < BEZIER_LOOKUP_SIZE; bucket++) {
+		while (sample < 9 && getBezierBucket(curves[sample << 1], time1, scale) < bucket) sample++;
+		segments[bucket] = (unsigned char) sample;
+	}
+}
+
+size_t CurveTimeline::getBezierSegment(size_t i, float time) {
+	size_t bezier = (i - _bezierStart) / BEZIER_SIZE;
+	const float *times = _bezierTimes.buffer() + (bezier << 1);
+	size_t segment = _bezierSegments[bezier * BEZIER_LOOKUP_SIZE + getBezierBucket(time, times[0], times[1])];
+	return findBezierSegment(_curves.buffer() + i, time, segment);
+}
+
+void CurveTimeline::clearBezierLookup() {
+	_bezierTimes.clear();
+	_bezierTimes.shrinkToFit();
+	_bezierSegments.clear();
+	_bezierSegments.shrinkToFit();
+}
+
+static bool isBezierSegment(const float *curves, size_t segment, float time) {
+	if (segment == 0) return curves[0] > time;
+	if (segment == 9) return curves[16] < time;
+	return curves[segment << 1] >= time && (segment == 1 ? curves[0] <= time : curves[(segment << 1) - 2] < time);
 }
 
 float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueOffset, size_t i) {
-	if (_curves[i] > time) {
-		float x = _frames[frameIndex], y = _frames[frameIndex + valueOffset];
-		return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
-	}
-	size_t n = i + BEZIER_SIZE;
-	for (i += 2; i < n; i += 2) {
-		if (_curves[i] >= time) {
-			float x = _curves[i - 2], y = _curves[i - 1];
-			return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
-		}
+	return getBezierSegmentValue(time, frameIndex, valueOffset, i, getBezierSegment(i, time));
+}
+
+void CurveTimeline::getBezierValues(float time, size_t frameIndex, size_t i, float *values, size_t count) {
+	// The values' curves usually share their time control points, so the segment found for the first value is checked first.
+	size_t segment = 0;
+	for (size_t v = 0; v < count; v++, i += BEZIER_SIZE) {
+		const float *curves = _curves.buffer() + i;
+		if (v == 0 || !isBezierSegment(curves, segment, time)) segment = getBezierSegment(i, time);
+		values[v] = getBezierSegmentValue(time, frameIndex, v + 1, i, segment);
 	}
-	frameIndex += getFrameEntries();
-	float x = _curves[n - 2], y = _curves[n - 1];
-	return y + (time - x) / (_frames[frameIndex] - x) * (_frames[frameIndex + valueOffset] - y);
+}
+
+float CurveTimeline::getBezierSegmentValue(float time, size_t frameIndex, size_t valueOffset, size_t i, size_t segment) {
+	float x, y, x2, y2;
+	if (segment == 0) {
+		x = _frames[frameIndex];
+		y = _frames[frameIndex + valueOffset];
+		x2 = _curves[i];
+		y2 = _curves[i + 1];
+	} else if (segment == 9) {
+		frameIndex += getFrameEntries();
+		x = _curves[i + BEZIER_SIZE - 2];
+		y = _curves[i + BEZIER_SIZE - 1];
+		x2 = _frames[frameIndex];
+		y2 = _frames[frameIndex + valueOffset];
+	} else {
+		i += segment << 1;
+		x = _curves[i - 2];
+		y = _curves[i - 1];
+		x2 = _curves[i];
+		y2 = _curves[i + 1];
+	}
+	return y + (time - x) / (x2 - x) * (y2 - y);
 }
 
 Vector<float> &CurveTimeline::getCurves() {
 	return _curves;
 }
 
+size_t CurveTimeline::getMemorySize() {
+	return Timeline::getMemorySize() + (_curves.getCapacity() + _bezierTimes.getCapacity()) * sizeof(float) +
+		   _bezierSegments.getCapacity();
+}
+
 RTTI_IMPL(CurveTimeline1, CurveTimeline)
 
 CurveTimeline1::CurveTimeline1(size_t frameCount, size_t bezierCount) : CurveTimeline(frameCount,
 																					  CurveTimeline1::ENTRIES,
-																					  bezierCount) {
+																					  bezierCount),
+																		_quantizedOffset(0),
+																		_quantizedScale(0) {
 }
 
 CurveTimeline1::~CurveTimeline1() {
 }
 
 void CurveTimeline1::setFrame(size_t frame, float time, float value) {
+	assert(_quantized.size() == 0);
 	frame <<= 1;
 	_frames[frame] = time;
 	_frames[frame + CurveTimeline1::VALUE] = value;
 }
 
 float CurveTimeline1::getCurveValue(float time) {
-	int i = (int) _frames.size() - 2;
-	for (int ii = 2; ii <= i; ii += 2) {
-		if (_frames[ii] > time) {
-			i = ii - 2;
-			break;
-		}
-	}
+	if (_quantized.size() > 0)
+		return getQuantizedValue(time, _frames, _curves, _quantized, _quantizedOffset, _quantizedScale);
 
+	int i = Animation::search(_frames, time, CurveTimeline1::ENTRIES);
 	int curveType = (int) _curves[i >> 1];
 	switch (curveType) {
 		case CurveTimeline::LINEAR: {
@@ -234,6 +369,127 @@ float CurveTimeline1::getScaleValue(float time, float alpha, MixBlend blend, Mix
 }
 
 
+bool CurveTimeline1::quantize(float tolerance) {
+	if (_quantized.size() > 0) return true;
+	size_t frameCount = getFrameCount();
+
+	// Fit the control points of each bezier to its samples and find the range of the values and control points.
+	Vector<float> times, curves, controls;
+	times.ensureCapacity(frameCount);
+	curves.ensureCapacity(frameCount);
+	float min = FLT_MAX, max = -FLT_MAX;
+	for (size_t frame = 0; frame < frameCount; frame++) {
+		size_t i = frame << 1;
+		float value = _frames[i + VALUE];
+		min = MathUtil::min(min, value);
+		max = MathUtil::max(max, value);
+		times.add(_frames[i]);
+		int curveType = (int) _curves[frame];
+		if (curveType < BEZIER) {
+			curves.add((float) curveType);
+			continue;
+		}
+		curves.add((float) (BEZIER + (controls.size() >> 2)));
+		float cx1, cy1, cx2, cy2;
+		const float *samples = _curves.buffer() + curveType - BEZIER;
+		fitBezier(samples, 0, _frames[i], _frames[i + ENTRIES], cx1, cx2);
+		fitBezier(samples, 1, value, _frames[i + ENTRIES + VALUE], cy1, cy2);
+		controls.add(cx1);
+		controls.add(cy1);
+		controls.add(cx2);
+		controls.add(cy2);
+		min = MathUtil::min(min, MathUtil::min(cy1, cy2));
+		max = MathUtil::max(max, MathUtil::max(cy1, cy2));
+	}
+
+	float scale = (max - min) / QUANTIZED_MAX;
+	Vector<unsigned short> quantized;
+	quantized.ensureCapacity(frameCount + controls.size());
+	for (size_t frame = 0; frame < frameCount; frame++)
+		quantized.add(quantizeValue(_frames[(frame << 1) + VALUE], min, scale));
+	for (size_t frame = 0, i = 0; frame < frameCount; frame++) {
+		if (curves[frame] < BEZIER) continue;
+		float time1 = times[frame], duration = times[frame + 1] - time1;
+		float timeScale = duration / QUANTIZED_MAX;
+		quantized.add(quantizeValue(MathUtil::clamp(controls[i], time1, time1 + duration), time1, timeScale));
+		quantized.add(quantizeValue(controls[i + 1], min, scale));
+		quantized.add(quantizeValue(MathUtil::clamp(controls[i + 2], time1, time1 + duration), time1, timeScale));
+		quantized.add(quantizeValue(controls[i + 3], min, scale));
+		i += 4;
+	}
+
+	// Compare the quantized and original values at the frames and between them.
+	const int steps = 8;
+	for (size_t frame = 0; frame < frameCount; frame++) {
+		float time1 = times[frame], duration = frame + 1 < frameCount ? times[frame + 1] - time1 : 0;
+		for (int step = 0; step < steps; step++) {
+			float time = time1 + duration * step / steps;
+			float error = getCurveValue(time) - getQuantizedValue(time, times, curves, quantized, min, scale);
+			if (MathUtil::abs(error) > tolerance) return false;
+			if (duration == 0) break;
+		}
+	}
+
+	_frames.clearAndAddAll(times);
+	_frames.shrinkToFit();
+	_frameEntries = 1;
+	_curves.clearAndAddAll(curves);
+	_curves.shrinkToFit();
+	clearBezierLookup();
+	_quantized.clearAndAddAll(quantized);
+	_quantizedOffset = min;
+	_quantizedScale = scale;
+	return true;
+}
+
+bool CurveTimeline1::isQuantized() {
+	return _quantized.size() > 0;
+}
+
+size_t CurveTimeline1::getMemorySize() {
+	return CurveTimeline::getMemorySize() + _quantized.getCapacity() * sizeof(unsigned short);
+}
+
+float CurveTimeline1::getQuantizedValue(float time, Vector<float> &times, Vector<float> &curves,
+										Vector<unsigned short> &quantized, float offset, float scale) {
+	int i = Animation::search(times, time);
+	float value = offset + quantized[i] * scale;
+	int curveType = (int) curves[i];
+	switch (curveType) {
+		case CurveTimeline::LINEAR: {
+			float before = times[i];
+			return value + (time - before) / (times[i + 1] - before) * (offset + quantized[i + 1] * scale - value);
+		}
+		case CurveTimeline::STEPPED:
+			return value;
+	}
+	float time1 = times[i], time2 = times[i + 1], value2 = offset + quantized[i + 1] * scale;
+	float timeScale = (time2 - time1) / QUANTIZED_MAX;
+	unsigned short *controls = quantized.buffer() + times.size() + ((curveType - BEZIER) << 2);
+	float samples[BEZIER_SIZE];
+	sampleBezier(samples, time1, value, time1 + controls[0] * timeScale, offset + controls[1] * scale,
+				 time1 + controls[2] * timeScale, offset + controls[3] * scale, time2, value2);
+	size_t segment = findBezierSegment(samples, time);
+	float x, y, x2, y2;
+	if (segment == 0) {
+		x = time1;
+		y = value;
+		x2 = samples[0];
+		y2 = samples[1];
+	} else if (segment == 9) {
+		x = samples[BEZIER_SIZE - 2];
+		y = samples[BEZIER_SIZE - 1];
+		x2 = time2;
+		y2 = value2;
+	} else {
+		x = samples[(segment << 1) - 2];
+		y = samples[(segment << 1) - 1];
+		x2 = samples[segment << 1];
+		y2 = samples[(segment << 1) + 1];
+	}
+	return y + (time - x) / (x2 - x) * (y2 - y);
+}
+
 RTTI_IMPL(CurveTimeline2, CurveTimeline)
 
 CurveTimeline2::CurveTimeline2(size_t frameCount, size_t bezierCount) : CurveTimeline(frameCount,
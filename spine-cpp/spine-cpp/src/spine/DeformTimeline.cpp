@@ -40,20 +40,101 @@
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
 
+#if defined(SPINE_NO_SIMD)
+#define SPINE_DEFORM_SCALAR
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SPINE_DEFORM_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SPINE_DEFORM_NEON
+#include <arm_neon.h>
+#else
+#define SPINE_DEFORM_SCALAR
+#endif
+
+#include <string.h>
+
 using namespace spine;
 
+static size_t getDeformLength(VertexAttachment *attachment) {
+	Vector<float> &vertices = attachment->getVertices();
+	return attachment->getBones().size() == 0 ? vertices.size() : vertices.size() / 3 * 2;
+}
+
+/// deform[i] += deltas[i] * scale
+static void addScaled(float *deform, const float *deltas, float scale, size_t count) {
+	size_t i = 0;
+#if defined(SPINE_DEFORM_SSE2)
+	__m128 s = _mm_set1_ps(scale);
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(deform + i, _mm_add_ps(_mm_loadu_ps(deform + i), _mm_mul_ps(_mm_loadu_ps(deltas + i), s)));
+#elif defined(SPINE_DEFORM_NEON)
+	for (; i + 4 <= count; i += 4)
+		vst1q_f32(deform + i, vaddq_f32(vld1q_f32(deform + i), vmulq_n_f32(vld1q_f32(deltas + i), scale)));
+#endif
+	for (; i < count; i++)
+		deform[i] += deltas[i] * scale;
+}
+
+/// deform[i] += (prev[i] + (next[i] - prev[i]) * percent) * scale
+static void addLerp(float *deform, const float *prev, const float *next, float percent, float scale, size_t count) {
+	size_t i = 0;
+#if defined(SPINE_DEFORM_SSE2)
+	__m128 p = _mm_set1_ps(percent), s = _mm_set1_ps(scale);
+	for (; i + 4 <= count; i += 4) {
+		__m128 a = _mm_loadu_ps(prev + i);
+		__m128 value = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(next + i), a), p));
+		_mm_storeu_ps(deform + i, _mm_add_ps(_mm_loadu_ps(deform + i), _mm_mul_ps(value, s)));
+	}
+#elif defined(SPINE_DEFORM_NEON)
+	for (; i + 4 <= count; i += 4) {
+		float32x4_t a = vld1q_f32(prev + i);
+		float32x4_t value = vaddq_f32(a, vmulq_n_f32(vsubq_f32(vld1q_f32(next + i), a), percent));
+		vst1q_f32(deform + i, vaddq_f32(vld1q_f32(deform + i), vmulq_n_f32(value, scale)));
+	}
+#endif
+	for (; i < count; i++) {
+		float a = prev[i];
+		deform[i] += (a + (next[i] - a) * percent) * scale;
+	}
+}
+
+/// deform[i] += (setup[i] - deform[i]) * alpha, with setup 0 when NULL.
+static void mixSetup(float *deform, const float *setup, float alpha, size_t count) {
+	size_t i = 0;
+#if defined(SPINE_DEFORM_SSE2)
+	__m128 a = _mm_set1_ps(alpha);
+	for (; i + 4 <= count; i += 4) {
+		__m128 d = _mm_loadu_ps(deform + i);
+		__m128 s = setup ? _mm_loadu_ps(setup + i) : _mm_setzero_ps();
+		_mm_storeu_ps(deform + i, _mm_add_ps(d, _mm_mul_ps(_mm_sub_ps(s, d), a)));
+	}
+#elif defined(SPINE_DEFORM_NEON)
+	for (; i + 4 <= count; i += 4) {
+		float32x4_t d = vld1q_f32(deform + i);
+		float32x4_t s = setup ? vld1q_f32(setup + i) : vdupq_n_f32(0);
+		vst1q_f32(deform + i, vaddq_f32(d, vmulq_n_f32(vsubq_f32(s, d), alpha)));
+	}
+#endif
+	for (; i < count; i++)
+		deform[i] += ((setup ? setup[i] : 0) - deform[i]) * alpha;
+}
+
 RTTI_IMPL(DeformTimeline, CurveTimeline)
 
 DeformTimeline::DeformTimeline(size_t frameCount, size_t bezierCount, int slotIndex, VertexAttachment *attachment)
-	: CurveTimeline(frameCount, 1, bezierCount), _slotIndex(slotIndex), _attachment(attachment) {
+	: CurveTimeline(frameCount, 1, bezierCount), _slotIndex(slotIndex), _vertexCount(getDeformLength(attachment)),
+	  _attachment(attachment) {
 	PropertyId ids[] = {((PropertyId) Property_Deform << 32) | ((slotIndex << 16 | attachment->_id) & 0xffffffff)};
 	setPropertyIds(ids, 1);
 
-	_vertices.ensureCapacity(frameCount);
+	_deltas.ensureCapacity(frameCount);
 	for (size_t i = 0; i < frameCount; ++i) {
 		Vector<float> vec;
-		_vertices.add(vec);
+		_deltas.add(vec);
 	}
+	_offsets.ensureCapacity(frameCount);
+	_offsets.setSize(frameCount, 0);
 }
 
 void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
@@ -81,8 +162,7 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 		blend = MixBlend_Setup;
 	}
 
-	Vector<Vector<float>> &vertices = _vertices;
-	size_t vertexCount = vertices[0].size();
+	size_t vertexCount = _vertexCount;
 
 	Vector<float> &frames = _frames;
 	if (time < _frames[0]) {
@@ -117,143 +197,63 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	}
 
 	deformArray.setSize(vertexCount, 0);
-	Vector<float> &deform = deformArray;
+	float *deform = deformArray.buffer();
+
+	// Unweighted vertex positions are the setup vertices plus the deltas, weighted deform offsets are the deltas.
+	const float *setupVertices = attachment->getBones().size() == 0 ? attachment->getVertices().buffer() : NULL;
+	switch (blend) {
+		case MixBlend_Setup:
+			if (setupVertices)
+				memcpy(deform, setupVertices, vertexCount * sizeof(float));
+			else
+				memset(deform, 0, vertexCount * sizeof(float));
+			break;
+		case MixBlend_First:
+		case MixBlend_Replace:
+			if (alpha == 1) {
+				if (setupVertices)
+					memcpy(deform, setupVertices, vertexCount * sizeof(float));
+				else
+					memset(deform, 0, vertexCount * sizeof(float));
+			} else
+				mixSetup(deform, setupVertices, alpha, vertexCount);
+			break;
+		case MixBlend_Add:
+			break;
+	}
 
+	// Only the floats within each frame's deltas are changed by the frames.
 	if (time >= frames[frames.size() - 1]) {// Time is after last frame.
-		Vector<float> &lastVertices = vertices[frames.size() - 1];
-		if (alpha == 1) {
-			if (blend == MixBlend_Add) {
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
-					// Unweighted vertex positions, no alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += lastVertices[i] - setupVertices[i];
-				} else {
-					// Weighted deform offsets, no alpha.
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += lastVertices[i];
-				}
-			} else {
-				// Vertex positions or deform offsets, no alpha.
-				memcpy(deform.buffer(), lastVertices.buffer(), vertexCount * sizeof(float));
-			}
-		} else {
-			switch (blend) {
-				case MixBlend_Setup: {
-					VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-					if (vertexAttachment->getBones().size() == 0) {
-						// Unweighted vertex positions, with alpha.
-						Vector<float> &setupVertices = vertexAttachment->getVertices();
-						for (size_t i = 0; i < vertexCount; i++) {
-							float setup = setupVertices[i];
-							deform[i] = setup + (lastVertices[i] - setup) * alpha;
-						}
-					} else {
-						// Weighted deform offsets, with alpha.
-						for (size_t i = 0; i < vertexCount; i++)
-							deform[i] = lastVertices[i] * alpha;
-					}
-					break;
-				}
-				case MixBlend_First:
-				case MixBlend_Replace:
-					// Vertex positions or deform offsets, with alpha.
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += (lastVertices[i] - deform[i]) * alpha;
-					break;
-				case MixBlend_Add:
-					VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-					if (vertexAttachment->getBones().size() == 0) {
-						// Unweighted vertex positions, no alpha.
-						Vector<float> &setupVertices = vertexAttachment->getVertices();
-						for (size_t i = 0; i < vertexCount; i++)
-							deform[i] += (lastVertices[i] - setupVertices[i]) * alpha;
-					} else {
-						// Weighted deform offsets, alpha.
-						for (size_t i = 0; i < vertexCount; i++)
-							deform[i] += lastVertices[i] * alpha;
-					}
-			}
-		}
+		size_t last = frames.size() - 1;
+		addScaled(deform + _offsets[last], _deltas[last].buffer(), alpha, _deltas[last].size());
 		return;
 	}
 
 	// Interpolate between the previous frame and the current frame.
 	int frame = Animation::search(frames, time);
 	float percent = getCurvePercent(time, frame);
-	Vector<float> &prevVertices = vertices[frame];
-	Vector<float> &nextVertices = vertices[frame + 1];
-
-	if (alpha == 1) {
-		if (blend == MixBlend_Add) {
-			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-			if (vertexAttachment->getBones().size() == 0) {
-				// Unweighted vertex positions, no alpha.
-				Vector<float> &setupVertices = vertexAttachment->getVertices();
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += prev + (nextVertices[i] - prev) * percent - setupVertices[i];
-				}
-			} else {
-				// Weighted deform offsets, no alpha.
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += prev + (nextVertices[i] - prev) * percent;
-				}
-			}
-		} else {
-			// Vertex positions or deform offsets, no alpha.
-			for (size_t i = 0; i < vertexCount; i++) {
-				float prev = prevVertices[i];
-				deform[i] = prev + (nextVertices[i] - prev) * percent;
-			}
-		}
-	} else {
-		switch (blend) {
-			case MixBlend_Setup: {
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
-					// Unweighted vertex positions, with alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i], setup = setupVertices[i];
-						deform[i] = setup + (prev + (nextVertices[i] - prev) * percent - setup) * alpha;
-					}
-				} else {
-					// Weighted deform offsets, with alpha.
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i];
-						deform[i] = (prev + (nextVertices[i] - prev) * percent) * alpha;
-					}
-				}
-				break;
-			}
-			case MixBlend_First:
-			case MixBlend_Replace:
-				// Vertex positions or deform offsets, with alpha.
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += (prev + (nextVertices[i] - prev) * percent - deform[i]) * alpha;
-				}
-				break;
-			case MixBlend_Add:
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
-					// Unweighted vertex positions, with alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i];
-						deform[i] += (prev + (nextVertices[i] - prev) * percent - setupVertices[i]) * alpha;
-					}
-				} else {
-					// Weighted deform offsets, with alpha.
-					for (size_t i = 0; i < vertexCount; i++) {
-						float prev = prevVertices[i];
-						deform[i] += (prev + (nextVertices[i] - prev) * percent) * alpha;
-					}
-				}
-		}
+	Vector<float> &prev = _deltas[frame], &next = _deltas[frame + 1];
+	size_t prevStart = _offsets[frame], prevEnd = prevStart + prev.size();
+	size_t nextStart = _offsets[frame + 1], nextEnd = nextStart + next.size();
+	if (prev.size() == 0) prevStart = prevEnd = nextStart;
+	if (next.size() == 0) nextStart = nextEnd = prevStart;
+
+	// Split the frames' deltas into the parts where both, only the previous or only the next frame has deltas.
+	size_t i = prevStart < nextStart ? prevStart : nextStart, end = prevEnd > nextEnd ? prevEnd : nextEnd;
+	while (i < end) {
+		bool inPrev = i >= prevStart && i < prevEnd, inNext = i >= nextStart && i < nextEnd;
+		size_t n = end;
+		if (prevStart > i && prevStart < n) n = prevStart;
+		if (prevEnd > i && prevEnd < n) n = prevEnd;
+		if (nextStart > i && nextStart < n) n = nextStart;
+		if (nextEnd > i && nextEnd < n) n = nextEnd;
+		if (inPrev && inNext)
+			addLerp(deform + i, prev.buffer() + (i - prevStart), next.buffer() + (i - nextStart), percent, alpha, n - i);
+		else if (inPrev)
+			addScaled(deform + i, prev.buffer() + (i - prevStart), (1 - percent) * alpha, n - i);
+		else if (inNext)
+			addScaled(deform + i, next.buffer() + (i - nextStart), percent * alpha, n - i);
+		i = n;
 	}
 }
 
@@ -278,6 +278,7 @@ void DeformTimeline::setBezier(size_t bezier, size_t frame, float value, float t
 		x += dx;
 		y += dy;
 	}
+	setBezierLookup(bezier, time1, time2);
 }
 
 float DeformTimeline::getCurvePercent(float time, int frame) {
@@ -294,29 +295,56 @@ float DeformTimeline::getCurvePercent(float time, int frame) {
 		}
 	}
 	i -= DeformTimeline::BEZIER;
-	if (_curves[i] > time) {
+	size_t segment = getBezierSegment(i, time);
+	if (segment == 0) {
 		float x = _frames[frame];
 		return _curves[i + 1] * (time - x) / (_curves[i] - x);
 	}
 	int n = i + DeformTimeline::BEZIER_SIZE;
-	for (i += 2; i < n; i += 2) {
-		if (_curves[i] >= time) {
-			float x = _curves[i - 2], y = _curves[i - 1];
-			return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
-		}
+	if (segment < 9) {
+		i += (int) segment << 1;
+		float x = _curves[i - 2], y = _curves[i - 1];
+		return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
 	}
 	float x = _curves[n - 2], y = _curves[n - 1];
 	return y + (1 - y) * (time - x) / (_frames[frame + getFrameEntries()] - x);
 }
 
 void DeformTimeline::setFrame(int frame, float time, Vector<float> &vertices) {
+	assert(vertices.size() == _vertexCount);
+	Vector<float> deltas;
+	deltas.addAll(vertices);
+	if (_attachment->getBones().size() == 0) {
+		Vector<float> &setupVertices = _attachment->getVertices();
+		for (size_t i = 0, n = deltas.size(); i < n; i++)
+			deltas[i] -= setupVertices[i];
+	}
+	setFrame(frame, time, deltas, 0);
+}
+
+void DeformTimeline::setFrame(int frame, float time, Vector<float> &deltas, int offset) {
+	assert(offset >= 0 && offset + deltas.size() <= _vertexCount);
 	_frames[frame] = time;
-	_vertices[frame].clear();
-	_vertices[frame].addAll(vertices);
+	size_t start = 0, end = deltas.size();
+	while (start < end && deltas[start] == 0)
+		start++;
+	while (end > start && deltas[end - 1] == 0)
+		end--;
+	Vector<float> &frameDeltas = _deltas[frame];
+	frameDeltas.clear();
+	frameDeltas.ensureCapacity(end - start);
+	for (size_t i = start; i < end; i++)
+		frameDeltas.add(deltas[i]);
+	frameDeltas.shrinkToFit();
+	_offsets[frame] = end > start ? offset + (int) start : 0;
+}
+
+Vector<Vector<float>> &DeformTimeline::getDeltas() {
+	return _deltas;
 }
 
-Vector<Vector<float>> &DeformTimeline::getVertices() {
-	return _vertices;
+Vector<int> &DeformTimeline::getOffsets() {
+	return _offsets;
 }
 
 VertexAttachment *DeformTimeline::getAttachment() {
@@ -325,4 +353,13 @@ VertexAttachment *DeformTimeline::getAttachment() {
 
 void DeformTimeline::setAttachment(VertexAttachment *inValue) {
 	_attachment = inValue;
+	_vertexCount = getDeformLength(inValue);
+}
+
+size_t DeformTimeline::getMemorySize() {
+	size_t size = CurveTimeline::getMemorySize() + _offsets.getCapacity() * sizeof(int) +
+				  _deltas.getCapacity() * sizeof(Vector<float>);
+	for (size_t i = 0, n = _deltas.size(); i < n; i++)
+		size += _deltas[i].getCapacity() * sizeof(float);
+	return size;
 }
@@ -98,10 +98,10 @@ void IkConstraintTimeline::apply(Skeleton &skeleton, float lastTime, float time,
 			break;
 		}
 		default: {
-			mix = getBezierValue(time, i, IkConstraintTimeline::MIX, curveType - IkConstraintTimeline::BEZIER);
-			softness = getBezierValue(time, i, IkConstraintTimeline::SOFTNESS,
-									  curveType + IkConstraintTimeline::BEZIER_SIZE -
-											  IkConstraintTimeline::BEZIER);
+			float values[2];
+			getBezierValues(time, i, curveType - IkConstraintTimeline::BEZIER, values, 2);
+			mix = values[0];
+			softness = values[1];
 		}
 	}
 
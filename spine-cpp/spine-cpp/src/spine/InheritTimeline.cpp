@@ -66,6 +66,7 @@ void InheritTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vect
 
 	Bone *bone = skeleton.getBones()[_boneIndex];
 	if (!bone->isActive()) return;
+	bone->_modified = true;
 
 	if (direction == MixDirection_Out) {
 		if (blend == MixBlend_Setup) bone->setInherit(bone->_data.getInherit());
@@ -31,6 +31,7 @@
 
 #include <spine/Bone.h>
 #include <spine/Slot.h>
+#include <spine/VertexSkinning.h>
 
 #include <assert.h>
 
@@ -136,32 +137,8 @@ void RegionAttachment::computeWorldVertices(Slot &slot, float *worldVertices, si
 	if (_sequence) _sequence->apply(&slot, this);
 
 	Bone &bone = slot.getBone();
-	float x = bone.getWorldX(), y = bone.getWorldY();
-	float a = bone.getA(), b = bone.getB(), c = bone.getC(), d = bone.getD();
-	float offsetX, offsetY;
-
-	offsetX = _vertexOffset[BRX];
-	offsetY = _vertexOffset[BRY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x;// br
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
-	offset += stride;
-
-	offsetX = _vertexOffset[BLX];
-	offsetY = _vertexOffset[BLY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x;// bl
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
-	offset += stride;
-
-	offsetX = _vertexOffset[ULX];
-	offsetY = _vertexOffset[ULY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x;// ul
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
-	offset += stride;
-
-	offsetX = _vertexOffset[URX];
-	offsetY = _vertexOffset[URY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x;// ur
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
+	VertexSkinning::transformRegion(_vertexOffset.buffer(), bone._a, bone._b, bone._c, bone._d, bone._worldX,
+									bone._worldY, worldVertices + offset, stride);
 }
 
 float RegionAttachment::getX() {
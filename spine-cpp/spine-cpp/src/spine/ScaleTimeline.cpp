@@ -58,6 +58,7 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 
 	Bone *bone = skeleton._bones[_boneIndex];
 	if (!bone->_active) return;
+	bone->_modified = true;
 
 	if (time < _frames[0]) {
 		switch (blend) {
@@ -93,9 +94,10 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 			break;
 		}
 		default: {
-			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
-			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-							   curveType + CurveTimeline2::BEZIER_SIZE - CurveTimeline2::BEZIER);
+			float values[2];
+			getBezierValues(time, i, curveType - CurveTimeline2::BEZIER, values, 2);
+			x = values[0];
+			y = values[1];
 		}
 	}
 	x *= bone->_data._scaleX;
@@ -170,7 +172,10 @@ void ScaleXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	SP_UNUSED(pEvents);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_scaleX = getScaleValue(time, alpha, blend, direction, bone->_scaleX, bone->_data._scaleX);
+	if (bone->_active) {
+		bone->_modified = true;
+		bone->_scaleX = getScaleValue(time, alpha, blend, direction, bone->_scaleX, bone->_data._scaleX);
+	}
 }
 
 RTTI_IMPL(ScaleYTimeline, CurveTimeline1)
@@ -190,5 +195,8 @@ void ScaleYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	SP_UNUSED(pEvents);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_scaleY = getScaleValue(time, alpha, blend, direction, bone->_scaleX, bone->_data._scaleY);
+	if (bone->_active) {
+		bone->_modified = true;
+		bone->_scaleY = getScaleValue(time, alpha, blend, direction, bone->_scaleX, bone->_data._scaleY);
+	}
 }
\ No newline at end of file
@@ -60,6 +60,7 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 
 	Bone *bone = skeleton._bones[_boneIndex];
 	if (!bone->_active) return;
+	bone->_modified = true;
 
 	if (time < _frames[0]) {
 		switch (blend) {
@@ -95,9 +96,10 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 			break;
 		}
 		default: {
-			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline2::BEZIER);
-			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-							   curveType + CurveTimeline2::BEZIER_SIZE - CurveTimeline2::BEZIER);
+			float values[2];
+			getBezierValues(time, i, curveType - CurveTimeline2::BEZIER, values, 2);
+			x = values[0];
+			y = values[1];
 		}
 	}
 
@@ -136,7 +138,10 @@ void ShearXTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	SP_UNUSED(direction);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_shearX = getRelativeValue(time, alpha, blend, bone->_shearX, bone->_data._shearX);
+	if (bone->_active) {
+		bone->_modified = true;
+		bone->_shearX = getRelativeValue(time, alpha, blend, bone->_shearX, bone->_data._shearX);
+	}
 }
 
 RTTI_IMPL(ShearYTimeline, CurveTimeline1)
@@ -144,7 +149,7 @@ RTTI_IMPL(ShearYTimeline, CurveTimeline1)
 ShearYTimeline::ShearYTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline1(frameCount,
 																									  bezierCount),
 																					   _boneIndex(boneIndex) {
-	PropertyId ids[] = {((PropertyId) Property_ShearX << 32) | boneIndex};
+	PropertyId ids[] = {((PropertyId) Property_ShearY << 32) | boneIndex};
 	setPropertyIds(ids, 1);
 }
 
@@ -158,5 +163,8 @@ void ShearYTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	SP_UNUSED(direction);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_shearY = getRelativeValue(time, alpha, blend, bone->_shearY, bone->_data._shearY);
+	if (bone->_active) {
+		bone->_modified = true;
+		bone->_shearY = getRelativeValue(time, alpha, blend, bone->_shearY, bone->_data._shearY);
+	}
 }
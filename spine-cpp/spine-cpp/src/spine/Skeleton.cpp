@@ -35,9 +35,11 @@
 #include <spine/PathConstraint.h>
 #include <spine/PhysicsConstraint.h>
 #include <spine/SkeletonData.h>
+#include <spine/Snapshot.h>
 #include <spine/Skin.h>
 #include <spine/Slot.h>
 #include <spine/TransformConstraint.h>
+#include <spine/UpdateCacheProgram.h>
 
 #include <spine/BoneData.h>
 #include <spine/IkConstraintData.h>
@@ -57,90 +59,176 @@
 
 using namespace spine;
 
+/// Rounds object sizes up so every object in the arena is suitably aligned.
+static size_t arenaSize(size_t size) {
+	return (size + 15) & ~(size_t) 15;
+}
+
+/// Destroys the objects, freeing only those not placed in the arena.
+template<typename T>
+static void destroyObjects(Vector<T *> &objects, char *arena, size_t arenaLength) {
+	for (size_t i = 0, n = objects.size(); i < n; i++) {
+		T *object = objects[i];
+		if ((char *) object >= arena && (char *) object < arena + arenaLength)
+			object->~T();
+		else
+			delete object;
+	}
+	objects.clear();
+}
+
 Skeleton::Skeleton(SkeletonData *skeletonData)
 	: _data(skeletonData), _skin(NULL), _color(1, 1, 1, 1), _scaleX(1),
-	  _scaleY(1), _x(0), _y(0), _time(0) {
-	_bones.ensureCapacity(_data->getBones().size());
-	for (size_t i = 0; i < _data->getBones().size(); ++i) {
-		BoneData *data = _data->getBones()[i];
+	  _scaleY(1), _x(0), _y(0), _time(0), _incremental(false), _incrementalUpdate(false), _worldInvalid(true),
+	  _recomputedBones(0), _skippedBones(0), _arena(NULL), _arenaLength(0) {
+	Vector<BoneData *> &boneDatas = _data->getBones();
+	Vector<SlotData *> &slotDatas = _data->getSlots();
+	Vector<IkConstraintData *> &ikDatas = _data->getIkConstraints();
+	Vector<TransformConstraintData *> &transformDatas = _data->getTransformConstraints();
+	Vector<PathConstraintData *> &pathDatas = _data->getPathConstraints();
+	Vector<PhysicsConstraintData *> &physicsDatas = _data->getPhysicsConstraints();
+
+	// All bones, slots and constraints are placed in one allocation.
+	_arenaLength = arenaSize(sizeof(Bone)) * boneDatas.size() + arenaSize(sizeof(Slot)) * slotDatas.size() +
+				   arenaSize(sizeof(IkConstraint)) * ikDatas.size() +
+				   arenaSize(sizeof(TransformConstraint)) * transformDatas.size() +
+				   arenaSize(sizeof(PathConstraint)) * pathDatas.size() +
+				   arenaSize(sizeof(PhysicsConstraint)) * physicsDatas.size();
+	if (_arenaLength > 0) _arena = SpineExtension::calloc<char>(_arenaLength, __FILE__, __LINE__);
+	char *memory = _arena;
+
+	Vector<int> childCounts;
+	childCounts.setSize(boneDatas.size(), 0);
+	for (size_t i = 0; i < boneDatas.size(); ++i) {
+		if (boneDatas[i]->getParent() != NULL) childCounts[boneDatas[i]->getParent()->getIndex()]++;
+	}
+
+	_bones.ensureCapacity(boneDatas.size());
+	for (size_t i = 0; i < boneDatas.size(); ++i) {
+		BoneData *data = boneDatas[i];
 
 		Bone *bone;
 		if (data->getParent() == NULL) {
-			bone = new (__FILE__, __LINE__) Bone(*data, *this, NULL);
+			bone = new (memory) Bone(*data, *this, NULL);
 		} else {
 			Bone *parent = _bones[data->getParent()->getIndex()];
-			bone = new (__FILE__, __LINE__) Bone(*data, *this, parent);
+			bone = new (memory) Bone(*data, *this, parent);
 			parent->getChildren().add(bone);
 		}
+		memory += arenaSize(sizeof(Bone));
+		bone->getChildren().ensureCapacity(childCounts[i]);
 
 		_bones.add(bone);
 	}
 
-	_slots.ensureCapacity(_data->getSlots().size());
-	_drawOrder.ensureCapacity(_data->getSlots().size());
-	for (size_t i = 0; i < _data->getSlots().size(); ++i) {
-		SlotData *data = _data->getSlots()[i];
+	_slots.ensureCapacity(slotDatas.size());
+	_drawOrder.ensureCapacity(slotDatas.size());
+	for (size_t i = 0; i < slotDatas.size(); ++i) {
+		SlotData *data = slotDatas[i];
 
 		Bone *bone = _bones[data->getBoneData().getIndex()];
-		Slot *slot = new (__FILE__, __LINE__) Slot(*data, *bone);
+		Slot *slot = new (memory) Slot(*data, *bone);
+		memory += arenaSize(sizeof(Slot));
 
 		_slots.add(slot);
 		_drawOrder.add(slot);
 	}
 
-	_ikConstraints.ensureCapacity(_data->getIkConstraints().size());
-	for (size_t i = 0; i < _data->getIkConstraints().size(); ++i) {
-		IkConstraintData *data = _data->getIkConstraints()[i];
-
-		IkConstraint *constraint =
-				new (__FILE__, __LINE__) IkConstraint(*data, *this);
-
-		_ikConstraints.add(constraint);
+	_ikConstraints.ensureCapacity(ikDatas.size());
+	for (size_t i = 0; i < ikDatas.size(); ++i) {
+		_ikConstraints.add(new (memory) IkConstraint(*ikDatas[i], *this));
+		memory += arenaSize(sizeof(IkConstraint));
 	}
 
-	_transformConstraints.ensureCapacity(_data->getTransformConstraints().size());
-	for (size_t i = 0; i < _data->getTransformConstraints().size(); ++i) {
-		TransformConstraintData *data = _data->getTransformConstraints()[i];
-
-		TransformConstraint *constraint =
-				new (__FILE__, __LINE__) TransformConstraint(*data, *this);
-
-		_transformConstraints.add(constraint);
+	_transformConstraints.ensureCapacity(transformDatas.size());
+	for (size_t i = 0; i < transformDatas.size(); ++i) {
+		_transformConstraints.add(new (memory) TransformConstraint(*transformDatas[i], *this));
+		memory += arenaSize(sizeof(TransformConstraint));
 	}
 
-	_pathConstraints.ensureCapacity(_data->getPathConstraints().size());
-	for (size_t i = 0; i < _data->getPathConstraints().size(); ++i) {
-		PathConstraintData *data = _data->getPathConstraints()[i];
-
-		PathConstraint *constraint =
-				new (__FILE__, __LINE__) PathConstraint(*data, *this);
-
-		_pathConstraints.add(constraint);
+	_pathConstraints.ensureCapacity(pathDatas.size());
+	for (size_t i = 0; i < pathDatas.size(); ++i) {
+		_pathConstraints.add(new (memory) PathConstraint(*pathDatas[i], *this));
+		memory += arenaSize(sizeof(PathConstraint));
 	}
 
-	_physicsConstraints.ensureCapacity(_data->getPhysicsConstraints().size());
-	for (size_t i = 0; i < _data->getPhysicsConstraints().size(); ++i) {
-		PhysicsConstraintData *data = _data->getPhysicsConstraints()[i];
-
-		PhysicsConstraint *constraint =
-				new (__FILE__, __LINE__) PhysicsConstraint(*data, *this);
-
-		_physicsConstraints.add(constraint);
+	_physicsConstraints.ensureCapacity(physicsDatas.size());
+	for (size_t i = 0; i < physicsDatas.size(); ++i) {
+		_physicsConstraints.add(new (memory) PhysicsConstraint(*physicsDatas[i], *this));
+		memory += arenaSize(sizeof(PhysicsConstraint));
 	}
 
 	updateCache();
 }
 
 Skeleton::~Skeleton() {
-	ContainerUtil::cleanUpVectorOfPointers(_bones);
-	ContainerUtil::cleanUpVectorOfPointers(_slots);
-	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
-	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
-	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
-	ContainerUtil::cleanUpVectorOfPointers(_physicsConstraints);
+	destroyObjects(_bones, _arena, _arenaLength);
+	destroyObjects(_slots, _arena, _arenaLength);
+	destroyObjects(_ikConstraints, _arena, _arenaLength);
+	destroyObjects(_transformConstraints, _arena, _arenaLength);
+	destroyObjects(_pathConstraints, _arena, _arenaLength);
+	destroyObjects(_physicsConstraints, _arena, _arenaLength);
+	if (_arena) SpineExtension::free(_arena, __FILE__, __LINE__);
 }
 
 void Skeleton::updateCache() {
+	bool shared = _skin == NULL || _data->_skins.contains(_skin);
+	UpdateCacheProgram *program = NULL;
+	if (shared) {
+		Vector<UpdateCacheProgram *> &programs = _data->_updateCachePrograms;
+		for (size_t i = 0, n = programs.size(); i < n; i++) {
+			if (programs[i]->_skin == _skin) {
+				program = programs[i];
+				break;
+			}
+		}
+	}
+
+	if (!program || !bindUpdateCache(*program)) {
+		sortUpdateCache();
+		if (shared && !program) _data->_updateCachePrograms.add(createUpdateCacheProgram());
+	}
+	_worldInvalid = true;
+}
+
+void Skeleton::markConstrainedBones() {
+	// A bone a constraint modified in the previous update is recomputed once more when the constraint no longer applies.
+	for (size_t i = 0, n = _bones.size(); i < n; i++) {
+		Bone *bone = _bones[i];
+		if (bone->_constrained) {
+			bone->_constrained = false;
+			bone->_modified = true;
+		}
+	}
+	for (size_t i = 0, n = _ikConstraints.size(); i < n; i++) {
+		IkConstraint *constraint = _ikConstraints[i];
+		if (!constraint->_active || constraint->_mix == 0) continue;
+		for (size_t ii = 0, nn = constraint->_bones.size(); ii < nn; ii++)
+			constraint->_bones[ii]->_constrained = true;
+	}
+	for (size_t i = 0, n = _transformConstraints.size(); i < n; i++) {
+		TransformConstraint *constraint = _transformConstraints[i];
+		if (!constraint->_active || (constraint->_mixRotate == 0 && constraint->_mixX == 0 && constraint->_mixY == 0 &&
+									 constraint->_mixScaleX == 0 && constraint->_mixScaleY == 0 &&
+									 constraint->_mixShearY == 0))
+			continue;
+		for (size_t ii = 0, nn = constraint->_bones.size(); ii < nn; ii++)
+			constraint->_bones[ii]->_constrained = true;
+	}
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++) {
+		PathConstraint *constraint = _pathConstraints[i];
+		if (!constraint->_active || (constraint->_mixRotate == 0 && constraint->_mixX == 0 && constraint->_mixY == 0))
+			continue;
+		for (size_t ii = 0, nn = constraint->_bones.size(); ii < nn; ii++)
+			constraint->_bones[ii]->_constrained = true;
+	}
+	for (size_t i = 0, n = _physicsConstraints.size(); i < n; i++) {
+		PhysicsConstraint *constraint = _physicsConstraints[i];
+		if (constraint->_active && constraint->_mix != 0) constraint->_bone->_constrained = true;
+	}
+}
+
+void Skeleton::sortUpdateCache() {
 	_updateCache.clear();
 
 	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
@@ -213,6 +301,109 @@ continue_outer:
 	}
 }
 
+bool Skeleton::bindUpdateCache(UpdateCacheProgram &program) {
+	// A path attachment the program was not created with requires sorting its bones.
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++) {
+		if (!program._pathConstraintsActive[i]) continue;
+		Attachment *attachment = _pathConstraints[i]->_target->getAttachment();
+		if (attachment != NULL && attachment->getRTTI().instanceOf(PathAttachment::rtti) &&
+			!program._pathAttachments.contains(attachment))
+			return false;
+	}
+
+	for (size_t i = 0, n = _bones.size(); i < n; i++)
+		_bones[i]->_active = program._bonesActive[i];
+	for (size_t i = 0, n = _ikConstraints.size(); i < n; i++)
+		_ikConstraints[i]->_active = program._ikConstraintsActive[i];
+	for (size_t i = 0, n = _transformConstraints.size(); i < n; i++)
+		_transformConstraints[i]->_active = program._transformConstraintsActive[i];
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++)
+		_pathConstraints[i]->_active = program._pathConstraintsActive[i];
+	for (size_t i = 0, n = _physicsConstraints.size(); i < n; i++)
+		_physicsConstraints[i]->_active = program._physicsConstraintsActive[i];
+
+	_updateCache.clear();
+	_updateCache.ensureCapacity(program._entries.size());
+	for (size_t i = 0, n = program._entries.size(); i < n; i++) {
+		UpdateCacheProgram::Entry &entry = program._entries[i];
+		switch (entry.type) {
+			case UpdateCacheProgram::EntryType_Bone:
+				_updateCache.add(_bones[entry.index]);
+				break;
+			case UpdateCacheProgram::EntryType_Ik:
+				_updateCache.add(_ikConstraints[entry.index]);
+				break;
+			case UpdateCacheProgram::EntryType_Transform:
+				_updateCache.add(_transformConstraints[entry.index]);
+				break;
+			case UpdateCacheProgram::EntryType_Path:
+				_updateCache.add(_pathConstraints[entry.index]);
+				break;
+			case UpdateCacheProgram::EntryType_Physics:
+				_updateCache.add(_physicsConstraints[entry.index]);
+				break;
+		}
+	}
+	return true;
+}
+
+UpdateCacheProgram *Skeleton::createUpdateCacheProgram() {
+	UpdateCacheProgram *program = new (__FILE__, __LINE__) UpdateCacheProgram(_skin);
+
+	program->_entries.ensureCapacity(_updateCache.size());
+	for (size_t i = 0, n = _updateCache.size(); i < n; i++) {
+		Updatable *updatable = _updateCache[i];
+		UpdateCacheProgram::Entry entry;
+		if (updatable->getRTTI().isExactly(Bone::rtti)) {
+			entry.type = UpdateCacheProgram::EntryType_Bone;
+			entry.index = ((Bone *) updatable)->_data.getIndex();
+		} else if (updatable->getRTTI().isExactly(IkConstraint::rtti)) {
+			entry.type = UpdateCacheProgram::EntryType_Ik;
+			entry.index = _ikConstraints.indexOf((IkConstraint *) updatable);
+		} else if (updatable->getRTTI().isExactly(TransformConstraint::rtti)) {
+			entry.type = UpdateCacheProgram::EntryType_Transform;
+			entry.index = _transformConstraints.indexOf((TransformConstraint *) updatable);
+		} else if (updatable->getRTTI().isExactly(PathConstraint::rtti)) {
+			entry.type = UpdateCacheProgram::EntryType_Path;
+			entry.index = _pathConstraints.indexOf((PathConstraint *) updatable);
+		} else {
+			entry.type = UpdateCacheProgram::EntryType_Physics;
+			entry.index = _physicsConstraints.indexOf((PhysicsConstraint *) updatable);
+		}
+		program->_entries.add(entry);
+	}
+
+	for (size_t i = 0, n = _bones.size(); i < n; i++)
+		program->_bonesActive.add(_bones[i]->_active);
+	for (size_t i = 0, n = _ikConstraints.size(); i < n; i++)
+		program->_ikConstraintsActive.add(_ikConstraints[i]->_active);
+	for (size_t i = 0, n = _transformConstraints.size(); i < n; i++)
+		program->_transformConstraintsActive.add(_transformConstraints[i]->_active);
+	for (size_t i = 0, n = _physicsConstraints.size(); i < n; i++)
+		program->_physicsConstraintsActive.add(_physicsConstraints[i]->_active);
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++) {
+		PathConstraint *constraint = _pathConstraints[i];
+		program->_pathConstraintsActive.add(constraint->_active);
+		if (!constraint->_active) continue;
+		size_t slotIndex = constraint->_target->getData().getIndex();
+		for (int ii = 0; ii < 2; ii++) {
+			Skin *skin = ii == 0 ? _skin : _data->_defaultSkin;
+			if (skin == NULL || (ii == 1 && skin == _skin)) continue;
+			Skin::AttachmentMap::Entries attachments = skin->getAttachments();
+			while (attachments.hasNext()) {
+				Skin::AttachmentMap::Entry entry = attachments.next();
+				if (entry._slotIndex == slotIndex && entry._attachment->getRTTI().instanceOf(PathAttachment::rtti))
+					program->_pathAttachments.add(entry._attachment);
+			}
+		}
+		Attachment *attachment = constraint->_target->getAttachment();
+		if (attachment != NULL && attachment->getRTTI().instanceOf(PathAttachment::rtti) &&
+			!program->_pathAttachments.contains(attachment))
+			program->_pathAttachments.add(attachment);
+	}
+	return program;
+}
+
 void Skeleton::printUpdateCache() {
 	for (size_t i = 0; i < _updateCache.size(); i++) {
 		Updatable *updatable = _updateCache[i];
@@ -235,6 +426,11 @@ void Skeleton::printUpdateCache() {
 }
 
 void Skeleton::updateWorldTransform(Physics physics) {
+	_incrementalUpdate = _incremental && !_worldInvalid;
+	_worldInvalid = false;
+	_recomputedBones = 0;
+	_skippedBones = 0;
+	if (_incremental) markConstrainedBones();
 	for (size_t i = 0, n = _bones.size(); i < n; i++) {
 		Bone *bone = _bones[i];
 		bone->_ax = bone->_x;
@@ -250,9 +446,11 @@ void Skeleton::updateWorldTransform(Physics physics) {
 		Updatable *updatable = _updateCache[i];
 		updatable->update(physics);
 	}
+	_incrementalUpdate = false;
 }
 
 void Skeleton::updateWorldTransform(Physics physics, Bone *parent) {
+	_worldInvalid = true;
 	// Apply the parent bone transform to the root bone. The root bone always
 	// inherits scale, rotation and reflection.
 	Bone *rootBone = getRootBone();
@@ -569,23 +767,36 @@ Color &Skeleton::getColor() { return _color; }
 void Skeleton::setPosition(float x, float y) {
 	_x = x;
 	_y = y;
+	_worldInvalid = true;
 }
 
 float Skeleton::getX() { return _x; }
 
-void Skeleton::setX(float inValue) { _x = inValue; }
+void Skeleton::setX(float inValue) {
+	_x = inValue;
+	_worldInvalid = true;
+}
 
 float Skeleton::getY() { return _y; }
 
-void Skeleton::setY(float inValue) { _y = inValue; }
+void Skeleton::setY(float inValue) {
+	_y = inValue;
+	_worldInvalid = true;
+}
 
 float Skeleton::getScaleX() { return _scaleX; }
 
-void Skeleton::setScaleX(float inValue) { _scaleX = inValue; }
+void Skeleton::setScaleX(float inValue) {
+	_scaleX = inValue;
+	_worldInvalid = true;
+}
 
 float Skeleton::getScaleY() { return _scaleY * (Bone::isYDown() ? -1 : 1); }
 
-void Skeleton::setScaleY(float inValue) { _scaleY = inValue; }
+void Skeleton::setScaleY(float inValue) {
+	_scaleY = inValue;
+	_worldInvalid = true;
+}
 
 void Skeleton::sortIkConstraint(IkConstraint *constraint) {
 	constraint->_active =
@@ -771,3 +982,175 @@ void Skeleton::physicsRotate(float x, float y, float degrees) {
 		_physicsConstraints[i]->rotate(x, y, degrees);
 	}
 }
+
+void Skeleton::setIncremental(bool incremental) {
+	_incremental = incremental;
+	_worldInvalid = true;
+}
+
+bool Skeleton::isIncremental() {
+	return _incremental;
+}
+
+int Skeleton::getRecomputedBoneCount() {
+	return _recomputedBones;
+}
+
+int Skeleton::getSkippedBoneCount() {
+	return _skippedBones;
+}
+
+template<typename T>
+static void snapshotColor(T &archive, Color &color) {
+	archive.value(color.r);
+	archive.value(color.g);
+	archive.value(color.b);
+	archive.value(color.a);
+}
+
+template<typename T>
+void Skeleton::snapshot(T &archive) {
+	Skin *skin = _skin;
+	archive.value(skin);
+	if (archive.isReading() && skin != _skin) {
+		_skin = skin;
+		updateCache();
+	}
+	snapshotColor(archive, _color);
+	archive.value(_scaleX);
+	archive.value(_scaleY);
+	archive.value(_x);
+	archive.value(_y);
+	archive.value(_time);
+
+	for (size_t i = 0, n = _bones.size(); i < n; i++) {
+		Bone *bone = _bones[i];
+		archive.value(bone->_x);
+		archive.value(bone->_y);
+		archive.value(bone->_rotation);
+		archive.value(bone->_scaleX);
+		archive.value(bone->_scaleY);
+		archive.value(bone->_shearX);
+		archive.value(bone->_shearY);
+		archive.value(bone->_ax);
+		archive.value(bone->_ay);
+		archive.value(bone->_arotation);
+		archive.value(bone->_ascaleX);
+		archive.value(bone->_ascaleY);
+		archive.value(bone->_ashearX);
+		archive.value(bone->_ashearY);
+		archive.value(bone->_a);
+		archive.value(bone->_b);
+		archive.value(bone->_worldX);
+		archive.value(bone->_c);
+		archive.value(bone->_d);
+		archive.value(bone->_worldY);
+		archive.value(bone->_inherit);
+	}
+
+	for (size_t i = 0, n = _slots.size(); i < n; i++) {
+		Slot *slot = _slots[i];
+		snapshotColor(archive, slot->_color);
+		snapshotColor(archive, slot->_darkColor);
+		archive.value(slot->_attachment);
+		archive.value(slot->_attachmentState);
+		archive.value(slot->_sequenceIndex);
+		archive.vector(slot->_deform);
+	}
+
+	for (size_t i = 0, n = _drawOrder.size(); i < n; i++) {
+		int index = archive.isReading() ? 0 : _drawOrder[i]->_data.getIndex();
+		archive.value(index);
+		if (archive.isReading() && index >= 0 && index < (int) _slots.size()) _drawOrder[i] = _slots[index];
+	}
+
+	for (size_t i = 0, n = _ikConstraints.size(); i < n; i++) {
+		IkConstraint *constraint = _ikConstraints[i];
+		archive.value(constraint->_bendDirection);
+		archive.value(constraint->_compress);
+		archive.value(constraint->_stretch);
+		archive.value(constraint->_mix);
+		archive.value(constraint->_softness);
+	}
+
+	for (size_t i = 0, n = _transformConstraints.size(); i < n; i++) {
+		TransformConstraint *constraint = _transformConstraints[i];
+		archive.value(constraint->_mixRotate);
+		archive.value(constraint->_mixX);
+		archive.value(constraint->_mixY);
+		archive.value(constraint->_mixScaleX);
+		archive.value(constraint->_mixScaleY);
+		archive.value(constraint->_mixShearY);
+	}
+
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++) {
+		PathConstraint *constraint = _pathConstraints[i];
+		archive.value(constraint->_position);
+		archive.value(constraint->_spacing);
+		archive.value(constraint->_mixRotate);
+		archive.value(constraint->_mixX);
+		archive.value(constraint->_mixY);
+	}
+
+	for (size_t i = 0, n = _physicsConstraints.size(); i < n; i++) {
+		PhysicsConstraint *constraint = _physicsConstraints[i];
+		archive.value(constraint->_inertia);
+		archive.value(constraint->_strength);
+		archive.value(constraint->_damping);
+		archive.value(constraint->_massInverse);
+		archive.value(constraint->_wind);
+		archive.value(constraint->_gravity);
+		archive.value(constraint->_mix);
+		archive.value(constraint->_reset);
+		archive.value(constraint->_ux);
+		archive.value(constraint->_uy);
+		archive.value(constraint->_cx);
+		archive.value(constraint->_cy);
+		archive.value(constraint->_tx);
+		archive.value(constraint->_ty);
+		archive.value(constraint->_xOffset);
+		archive.value(constraint->_xVelocity);
+		archive.value(constraint->_yOffset);
+		archive.value(constraint->_yVelocity);
+		archive.value(constraint->_rotateOffset);
+		archive.value(constraint->_rotateVelocity);
+		archive.value(constraint->_scaleOffset);
+		archive.value(constraint->_scaleVelocity);
+		archive.value(constraint->_remaining);
+		archive.value(constraint->_lastTime);
+	}
+}
+
+size_t Skeleton::getSnapshotSize() {
+	SnapshotWriter writer(NULL, 0);
+	SnapshotHeader header = SnapshotHeader();
+	writer.value(header);
+	snapshot(writer);
+	return writer.getSize();
+}
+
+size_t Skeleton::writeSnapshot(void *buffer, size_t size) {
+	SnapshotWriter writer(buffer, size);
+	SnapshotHeader header = {SnapshotHeader::MAGIC, SnapshotHeader::VERSION, SnapshotHeader::Type_Skeleton, 0, _data};
+	writer.value(header);
+	snapshot(writer);
+	if (!writer.isValid()) return 0;
+	header.size = (uint32_t) writer.getSize();
+	memcpy(buffer, &header, sizeof(SnapshotHeader));
+	return writer.getSize();
+}
+
+bool Skeleton::readSnapshot(const void *buffer, size_t size) {
+	SnapshotHeader header;
+	if (!SnapshotHeader::read(buffer, size, SnapshotHeader::Type_Skeleton, _data, header)) return false;
+	// Checks the whole snapshot first, so a truncated snapshot leaves the skeleton unchanged.
+	SnapshotValidator validator(buffer, header.size);
+	validator.value(header);
+	snapshot(validator);
+	if (!validator.isValid()) return false;
+	SnapshotReader reader(buffer, header.size);
+	reader.value(header);
+	snapshot(reader);
+	_worldInvalid = true;
+	return reader.isValid();
+}
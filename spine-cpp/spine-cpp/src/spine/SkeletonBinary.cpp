@@ -78,13 +78,14 @@ using namespace spine;
 
 SkeletonBinary::SkeletonBinary(Atlas *atlasArray) : _attachmentLoader(
 															new (__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)),
-													_error(), _scale(1), _ownsLoader(true) {
+													_error(), _scale(1), _quantizationTolerance(0), _ownsLoader(true) {
 }
 
 SkeletonBinary::SkeletonBinary(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(
 																							  attachmentLoader),
 																					  _error(),
 																					  _scale(1),
+																					  _quantizationTolerance(0),
 																					  _ownsLoader(ownsLoader) {
 	assert(_attachmentLoader != NULL);
 }
@@ -392,6 +393,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 			delete skeletonData;
 			return NULL;
 		}
+		animation->_index = i;
 		skeletonData->_animations[i] = animation;
 	}
 
@@ -609,6 +611,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 				return NULL;
 			}
 			int verticesLength = readVertices(input, box->getVertices(), box->getBones(), (flags & 16) != 0);
+			box->updateSkinning();
 			box->setWorldVerticesLength(verticesLength);
 			if (nonessential) {
 				readColor(input, box->getColor());
@@ -650,6 +653,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			mesh->_color.set(color);
 			mesh->_bones.addAll(bones);
 			mesh->_vertices.addAll(vertices);
+			mesh->updateSkinning();
 			mesh->setWorldVerticesLength(verticesLength);
 			mesh->_triangles.addAll(triangles);
 			mesh->_regionUVs.addAll(uvs);
@@ -705,6 +709,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			path->_closed = (flags & 16) != 0;
 			path->_constantSpeed = (flags & 32) != 0;
 			int verticesLength = readVertices(input, path->getVertices(), path->getBones(), (flags & 64) != 0);
+			path->updateSkinning();
 			path->setWorldVerticesLength(verticesLength);
 			int lengthsLength = verticesLength / 6;
 			path->_lengths.setSize(lengthsLength, 0);
@@ -741,6 +746,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 				return NULL;
 			}
 			int verticesLength = readVertices(input, clip->getVertices(), clip->getBones(), (flags & 16) != 0);
+			clip->updateSkinning();
 			clip->setWorldVerticesLength(verticesLength);
 			clip->_endSlot = skeletonData->_slots[endSlotIndex];
 			if (nonessential) {
@@ -1342,45 +1348,29 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 				switch (timelineType) {
 					case ATTACHMENT_DEFORM: {
 						VertexAttachment *attachment = static_cast<VertexAttachment *>(baseAttachment);
-						bool weighted = attachment->_bones.size() > 0;
-						Vector<float> &vertices = attachment->_vertices;
-						int deformLength = weighted ? (int) vertices.size() / 3 * 2 : (int) vertices.size();
 
 						int bezierCount = readVarint(input, true);
 						DeformTimeline *timeline = new (__FILE__, __LINE__) DeformTimeline(frameCount, bezierCount, slotIndex,
 																						   attachment);
 
 						float time = readFloat(input);
+						Vector<float> deltas;
 						for (int frame = 0, bezier = 0;; ++frame) {
-							Vector<float> deform;
-							size_t end = (size_t) readVarint(input, true);
-							if (end == 0) {
-								if (weighted) {
-									deform.setSize(deformLength, 0);
-									for (int iiii = 0; iiii < deformLength; ++iiii)
-										deform[iiii] = 0;
-								} else {
-									deform.clearAndAddAll(vertices);
-								}
-							} else {
-								deform.setSize(deformLength, 0);
-								size_t start = (size_t) readVarint(input, true);
-								end += start;
+							deltas.clear();
+							size_t start = 0, end = (size_t) readVarint(input, true);
+							if (end != 0) {
+								start = (size_t) readVarint(input, true);
+								deltas.ensureCapacity(end);
 								if (scale == 1) {
-									for (size_t v = start; v < end; ++v)
-										deform[v] = readFloat(input);
+									for (size_t v = 0; v < end; ++v)
+										deltas.add(readFloat(input));
 								} else {
-									for (size_t v = start; v < end; ++v)
-										deform[v] = readFloat(input) * scale;
-								}
-
-								if (!weighted) {
-									for (size_t v = 0, vn = deform.size(); v < vn; ++v)
-										deform[v] += vertices[v];
+									for (size_t v = 0; v < end; ++v)
+										deltas.add(readFloat(input) * scale);
 								}
 							}
 
-							timeline->setFrame(frame, time, deform);
+							timeline->setFrame(frame, time, deltas, (int) start);
 							if (frame == frameLast) break;
 							float time2 = readFloat(input);
 							switch (readSByte(input)) {
@@ -1485,6 +1475,8 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 	float duration = 0;
 	for (int i = 0, n = (int) timelines.size(); i < n; i++) {
 		duration = MathUtil::max(duration, (timelines[i])->getDuration());
+		if (_quantizationTolerance > 0 && timelines[i]->getRTTI().instanceOf(CurveTimeline1::rtti))
+			static_cast<CurveTimeline1 *>(timelines[i])->quantize(_quantizationTolerance);
 	}
 	return new (__FILE__, __LINE__) Animation(String(name), timelines, duration);
 }
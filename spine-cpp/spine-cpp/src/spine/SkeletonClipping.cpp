@@ -31,16 +31,82 @@
 
 #include <spine/ClippingAttachment.h>
 #include <spine/Slot.h>
+#include <spine/MathUtil.h>
+#include <float.h>
 
 using namespace spine;
 
-SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL) {
+SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL), _maxCacheSize(256), _minX(0), _minY(0), _maxX(0), _maxY(0), _rectangle(false),
+									   _acceptedCount(0), _rejectedCount(0), _clippedCount(0), _shareVertices(false) {
 	_clipOutput.ensureCapacity(128);
 	_clippedVertices.ensureCapacity(128);
 	_clippedTriangles.ensureCapacity(128);
 	_clippedUVs.ensureCapacity(128);
 }
 
+SkeletonClipping::~SkeletonClipping() {
+	disposeCaches();
+	for (size_t i = 0; i < _cachedPolygons.size(); ++i)
+		_polygonPool.free(_cachedPolygons[i]);
+}
+
+void SkeletonClipping::clearCache() {
+	assert(_clipAttachment == NULL);
+	disposeCaches();
+}
+
+void SkeletonClipping::disposeCaches() {
+	HashMap<ClippingAttachment *, ClippingCache *>::Entries entries = _caches.getEntries();
+	while (entries.hasNext())
+		delete entries.next().value;
+	_caches.clear();
+}
+
+size_t SkeletonClipping::getMaxCacheSize() {
+	return _maxCacheSize;
+}
+
+void SkeletonClipping::setMaxCacheSize(size_t maxCacheSize) {
+	_maxCacheSize = maxCacheSize;
+	if (_caches.size() > maxCacheSize) disposeCaches();
+}
+
+SkeletonClipping::ClippingCache *SkeletonClipping::getCache(Slot &slot, ClippingAttachment *clip) {
+	if (clip->getBones().size() > 0) return NULL;
+	Vector<float> &vertices = slot.getDeform().size() > 0 ? slot.getDeform() : clip->getVertices();
+	size_t n = clip->getWorldVerticesLength();
+	if (vertices.size() < n) return NULL;
+
+	ClippingCache *cache = _caches.get(clip, NULL);
+	if (cache && cache->vertices.size() == n && memcmp(cache->vertices.buffer(), vertices.buffer(), n * sizeof(float)) == 0)
+		return cache;
+	if (!cache) {
+		if (_maxCacheSize == 0) return NULL;
+		if (_caches.size() >= _maxCacheSize) disposeCaches();
+		cache = new (__FILE__, __LINE__) ClippingCache();
+		_caches.put(clip, cache);
+	}
+	cache->vertices.setSize(n, 0);
+	memcpy(cache->vertices.buffer(), vertices.buffer(), n * sizeof(float));
+
+	// Decompose in local space, keeping the offsets of each polygon's vertices into the unreversed vertices.
+	Vector<float> &polygon = _clippingPolygon;
+	polygon.clearAndAddAll(cache->vertices);
+	makeClockwise(polygon);
+	bool reversed = memcmp(polygon.buffer(), cache->vertices.buffer(), n * sizeof(float)) != 0;
+	_triangulator.decompose(polygon, _triangulator.triangulate(polygon));
+	Vector<Vector<int> *> &polygonsIndices = _triangulator.getConvexPolygonsIndices();
+	cache->offsets.clear();
+	cache->counts.clear();
+	for (size_t i = 0; i < polygonsIndices.size(); ++i) {
+		Vector<int> &indices = *polygonsIndices[i];
+		for (size_t ii = 0; ii < indices.size(); ++ii)
+			cache->offsets.add(reversed ? (int) n - 2 - indices[ii] : indices[ii]);
+		cache->counts.add((int) indices.size());
+	}
+	return cache;
+}
+
 size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	if (_clipAttachment != NULL) {
 		return 0;
@@ -49,8 +115,31 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	_clipAttachment = clip;
 
 	int n = (int) clip->getWorldVerticesLength();
+	ClippingCache *cache = getCache(slot, clip);
 	_clippingPolygon.setSize(n, 0);
 	clip->computeWorldVertices(slot, 0, n, _clippingPolygon, 0, 2);
+	if (cache) {
+		// Gather the world vertices of each cached polygon, makeClockwise() reverses them if the bone flips the winding.
+		for (size_t i = 0; i < _cachedPolygons.size(); ++i)
+			_polygonPool.free(_cachedPolygons[i]);
+		_cachedPolygons.clear();
+		for (size_t i = 0, o = 0; i < cache->counts.size(); ++i) {
+			Vector<float> &polygon = *_polygonPool.obtain();
+			polygon.clear();
+			for (int ii = 0, nn = cache->counts[i]; ii < nn; ++ii, ++o) {
+				int offset = cache->offsets[o];
+				polygon.add(_clippingPolygon[offset]);
+				polygon.add(_clippingPolygon[offset + 1]);
+			}
+			makeClockwise(polygon);
+			polygon.add(polygon[0]);
+			polygon.add(polygon[1]);
+			_cachedPolygons.add(&polygon);
+		}
+		_clippingPolygons = &_cachedPolygons;
+		computeBounds();
+		return _cachedPolygons.size();
+	}
 	makeClockwise(_clippingPolygon);
 	_clippingPolygons = &_triangulator.decompose(_clippingPolygon, _triangulator.triangulate(_clippingPolygon));
 
@@ -61,10 +150,87 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 		polygon.add(polygon[0]);
 		polygon.add(polygon[1]);
 	}
+	computeBounds();
 
 	return (*_clippingPolygons).size();
 }
 
+void SkeletonClipping::computeBounds() {
+	Vector<Vector<float> *> &polygons = *_clippingPolygons;
+	size_t polygonsCount = polygons.size();
+	_clippingBounds.setSize(polygonsCount << 2, 0);
+	_clippingEdges.setSize(polygonsCount, 0);
+	_minX = _minY = FLT_MAX;
+	_maxX = _maxY = -FLT_MAX;
+	for (size_t p = 0; p < polygonsCount; p++) {
+		Vector<float> &polygon = *polygons[p];
+		_clippingEdges[p] = p == 0 ? 0 : _clippingEdges[p - 1] + ((int) polygons[p - 1]->size() >> 1) - 1;
+		float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+		for (size_t i = 0, n = polygon.size(); i < n; i += 2) {
+			float x = polygon[i], y = polygon[i + 1];
+			if (x < minX) minX = x;
+			if (x > maxX) maxX = x;
+			if (y < minY) minY = y;
+			if (y > maxY) maxY = y;
+		}
+		float *bounds = _clippingBounds.buffer() + (p << 2);
+		bounds[0] = minX;
+		bounds[1] = minY;
+		bounds[2] = maxX;
+		bounds[3] = maxY;
+		if (minX < _minX) _minX = minX;
+		if (minY < _minY) _minY = minY;
+		if (maxX > _maxX) _maxX = maxX;
+		if (maxY > _maxY) _maxY = maxY;
+	}
+
+	// A single polygon of 4 vertices (plus the repeated first vertex) with only horizontal and vertical edges.
+	_rectangle = false;
+	if (polygonsCount == 1 && polygons[0]->size() == 10) {
+		Vector<float> &polygon = *polygons[0];
+		_rectangle = true;
+		for (size_t i = 0; i < 8; i += 2) {
+			if (polygon[i] != polygon[i + 2] && polygon[i + 1] != polygon[i + 3]) {
+				_rectangle = false;
+				break;
+			}
+		}
+	}
+}
+
+bool SkeletonClipping::contains(size_t polygon, float x1, float y1, float x2, float y2, float x3, float y3) {
+	if (_rectangle) {
+		// The edge test of clip() against horizontal and vertical edges reduces to comparing with the bounds.
+		float *bounds = _clippingBounds.buffer();
+		return MathUtil::min(x1, MathUtil::min(x2, x3)) > bounds[0] && MathUtil::max(x1, MathUtil::max(x2, x3)) < bounds[2] &&
+			   MathUtil::min(y1, MathUtil::min(y2, y3)) > bounds[1] && MathUtil::max(y1, MathUtil::max(y2, y3)) < bounds[3];
+	}
+	Vector<float> &clippingVertices = *(*_clippingPolygons)[polygon];
+	for (size_t i = 0, n = clippingVertices.size() - 2; i < n; i += 2) {
+		float edgeX = clippingVertices[i], edgeY = clippingVertices[i + 1];
+		float ex = edgeX - clippingVertices[i + 2], ey = edgeY - clippingVertices[i + 3];
+		if (!(ey * (edgeX - x1) > ex * (edgeY - y1)) || !(ey * (edgeX - x2) > ex * (edgeY - y2)) ||
+			!(ey * (edgeX - x3) > ex * (edgeY - y3)))
+			return false;
+	}
+	return true;
+}
+
+int SkeletonClipping::classify(float *vertices, unsigned short *triangles, size_t trianglesLength, size_t stride) {
+	float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+	for (size_t i = 0; i < trianglesLength; i++) {
+		int vertexOffset = triangles[i] * (int) stride;
+		float x = vertices[vertexOffset], y = vertices[vertexOffset + 1];
+		if (x < minX) minX = x;
+		if (x > maxX) maxX = x;
+		if (y < minY) minY = y;
+		if (y > maxY) maxY = y;
+	}
+	if (maxX < _minX || minX > _maxX || maxY < _minY || minY > _maxY) return -1;
+	if (_rectangle && minX > _minX && maxX < _maxX && minY > _minY && maxY < _maxY) return 1;
+	return 0;
+}
+
 void SkeletonClipping::clipEnd(Slot &slot) {
 	if (_clipAttachment != NULL && _clipAttachment->_endSlot == &slot._data) {
 		clipEnd();
@@ -96,6 +262,17 @@ void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles,
 	clippedTriangles.clear();
 
 	int stride = 2;
+	if (_shareVertices) {
+		clipTrianglesShared(vertices, triangles, trianglesLength, NULL, stride);
+		return;
+	}
+	int bounds = classify(vertices, triangles, trianglesLength, stride);
+	if (bounds < 0) {
+		_rejectedCount += trianglesLength / 3;
+		return;
+	}
+	bool inside = bounds > 0;
+
 	size_t i = 0;
 continue_outer:
 	for (; i < trianglesLength; i += 3) {
@@ -107,10 +284,19 @@ continue_outer:
 
 		vertexOffset = triangles[i + 2] * stride;
 		float x3 = vertices[vertexOffset], y3 = vertices[vertexOffset + 1];
+		float minX = MathUtil::min(x1, MathUtil::min(x2, x3)), maxX = MathUtil::max(x1, MathUtil::max(x2, x3));
+		float minY = MathUtil::min(y1, MathUtil::min(y2, y3)), maxY = MathUtil::max(y1, MathUtil::max(y2, y3));
 
+		// Polygons the triangle's bounds miss are skipped, triangles inside a polygon are not clipped.
+		bool clipped = false;
 		for (size_t p = 0; p < polygonsCount; p++) {
+			float *polygonBounds = _clippingBounds.buffer() + (p << 2);
+			if (!inside && (maxX < polygonBounds[0] || minX > polygonBounds[2] || maxY < polygonBounds[1] || minY > polygonBounds[3]))
+				continue;
 			size_t s = clippedVertices.size();
-			if (clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
+			bool accept = inside || contains(p, x1, y1, x2, y2, x3, y3);
+			if (!accept) clipped = true;
+			if (!accept && clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
 				size_t clipOutputLength = clipOutput.size();
 				if (clipOutputLength == 0) continue;
 
@@ -149,9 +335,17 @@ continue_outer:
 				clippedTriangles[s + 2] = (unsigned short) (index + 2);
 				index += 3;
 				i += 3;
+				if (clipped)
+					_clippedCount++;
+				else
+					_acceptedCount++;
 				goto continue_outer;
 			}
 		}
+		if (clipped)
+			_clippedCount++;
+		else
+			_rejectedCount++;
 	}
 }
 
@@ -173,6 +367,17 @@ void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles,
 	_clippedUVs.clear();
 	clippedTriangles.clear();
 
+	if (_shareVertices) {
+		clipTrianglesShared(vertices, triangles, trianglesLength, uvs, stride);
+		return;
+	}
+	int bounds = classify(vertices, triangles, trianglesLength, stride);
+	if (bounds < 0) {
+		_rejectedCount += trianglesLength / 3;
+		return;
+	}
+	bool inside = bounds > 0;
+
 	size_t i = 0;
 continue_outer:
 	for (; i < trianglesLength; i += 3) {
@@ -187,10 +392,19 @@ continue_outer:
 		vertexOffset = triangles[i + 2] * (int) stride;
 		float x3 = vertices[vertexOffset], y3 = vertices[vertexOffset + 1];
 		float u3 = uvs[vertexOffset], v3 = uvs[vertexOffset + 1];
+		float minX = MathUtil::min(x1, MathUtil::min(x2, x3)), maxX = MathUtil::max(x1, MathUtil::max(x2, x3));
+		float minY = MathUtil::min(y1, MathUtil::min(y2, y3)), maxY = MathUtil::max(y1, MathUtil::max(y2, y3));
 
+		// Polygons the triangle's bounds miss are skipped, triangles inside a polygon are not clipped.
+		bool clipped = false;
 		for (size_t p = 0; p < polygonsCount; p++) {
+			float *polygonBounds = _clippingBounds.buffer() + (p << 2);
+			if (!inside && (maxX < polygonBounds[0] || minX > polygonBounds[2] || maxY < polygonBounds[1] || minY > polygonBounds[3]))
+				continue;
 			size_t s = clippedVertices.size();
-			if (clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
+			bool accept = inside || contains(p, x1, y1, x2, y2, x3, y3);
+			if (!accept) clipped = true;
+			if (!accept && clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
 				size_t clipOutputLength = clipOutput.size();
 				if (clipOutputLength == 0) continue;
 				float d0 = y2 - y3, d1 = x3 - x2, d2 = x1 - x3, d4 = y3 - y1;
@@ -246,9 +460,17 @@ continue_outer:
 				clippedTriangles[s + 2] = (unsigned short) (index + 2);
 				index += 3;
 				i += 3;
+				if (clipped)
+					_clippedCount++;
+				else
+					_acceptedCount++;
 				goto continue_outer;
 			}
 		}
+		if (clipped)
+			_clippedCount++;
+		else
+			_rejectedCount++;
 	}
 }
 
@@ -268,6 +490,252 @@ Vector<float> &SkeletonClipping::getClippedUVs() {
 	return _clippedUVs;
 }
 
+size_t SkeletonClipping::getAcceptedCount() {
+	return _acceptedCount;
+}
+
+size_t SkeletonClipping::getRejectedCount() {
+	return _rejectedCount;
+}
+
+size_t SkeletonClipping::getClippedCount() {
+	return _clippedCount;
+}
+
+void SkeletonClipping::resetCounts() {
+	_acceptedCount = 0;
+	_rejectedCount = 0;
+	_clippedCount = 0;
+}
+
+bool SkeletonClipping::getShareVertices() {
+	return _shareVertices;
+}
+
+void SkeletonClipping::setShareVertices(bool shareVertices) {
+	_shareVertices = shareVertices;
+}
+
+void SkeletonClipping::clipTrianglesShared(float *vertices, unsigned short *triangles, size_t trianglesLength, float *uvs,
+										   size_t stride) {
+	Vector<unsigned short> &clippedTriangles = _clippedTriangles;
+	int bounds = classify(vertices, triangles, trianglesLength, stride);
+	if (bounds < 0) {
+		_rejectedCount += trianglesLength / 3;
+		return;
+	}
+	bool inside = bounds > 0;
+
+	int vertexCount = 0;
+	for (size_t i = 0; i < trianglesLength; i++)
+		if (triangles[i] >= vertexCount) vertexCount = triangles[i] + 1;
+	_vertexIds.setSize(vertexCount, -1);
+	for (int i = 0; i < vertexCount; i++)
+		_vertexIds[i] = -1;
+	_edgeVertices.clear();
+
+	TriangleUVs triangle;
+	for (size_t i = 0; i < trianglesLength; i += 3) {
+		unsigned short *indices = triangles + i;
+		int vertexOffset = indices[0] * (int) stride;
+		float x1 = vertices[vertexOffset], y1 = vertices[vertexOffset + 1];
+		vertexOffset = indices[1] * (int) stride;
+		float x2 = vertices[vertexOffset], y2 = vertices[vertexOffset + 1];
+		vertexOffset = indices[2] * (int) stride;
+		float x3 = vertices[vertexOffset], y3 = vertices[vertexOffset + 1];
+		float minX = MathUtil::min(x1, MathUtil::min(x2, x3)), maxX = MathUtil::max(x1, MathUtil::max(x2, x3));
+		float minY = MathUtil::min(y1, MathUtil::min(y2, y3)), maxY = MathUtil::max(y1, MathUtil::max(y2, y3));
+
+		bool clipped = false, emitted = false;
+		for (size_t p = 0; p < _clippingPolygons->size(); p++) {
+			float *polygonBounds = _clippingBounds.buffer() + (p << 2);
+			if (!inside && (maxX < polygonBounds[0] || minX > polygonBounds[2] || maxY < polygonBounds[1] || minY > polygonBounds[3]))
+				continue;
+			if (!inside && !contains(p, x1, y1, x2, y2, x3, y3)) {
+				clipped = true;
+				if (clipShared(i / 3, indices, x1, y1, x2, y2, x3, y3, p)) {
+					size_t n = _sharedOutput.size();
+					if (n == 0) continue;
+					if (uvs) {
+						triangle.x3 = x3;
+						triangle.y3 = y3;
+						triangle.d0 = y2 - y3;
+						triangle.d1 = x3 - x2;
+						triangle.d2 = x1 - x3;
+						triangle.d4 = y3 - y1;
+						triangle.d = 1 / (triangle.d0 * triangle.d2 + triangle.d1 * (y1 - y3));
+						triangle.u1 = uvs[indices[0] * stride];
+						triangle.v1 = uvs[indices[0] * stride + 1];
+						triangle.u2 = uvs[indices[1] * stride];
+						triangle.v2 = uvs[indices[1] * stride + 1];
+						triangle.u3 = uvs[indices[2] * stride];
+						triangle.v3 = uvs[indices[2] * stride + 1];
+					}
+					_fan.setSize(n, 0);
+					for (size_t ii = 0; ii < n; ii++)
+						_fan[ii] = sharedVertex(_sharedOutput[ii], vertices, uvs, stride, triangle);
+					size_t s = clippedTriangles.size();
+					clippedTriangles.setSize(s + 3 * (n - 2), 0);
+					for (size_t ii = 1; ii < n - 1; ii++) {
+						clippedTriangles[s] = _fan[0];
+						clippedTriangles[s + 1] = _fan[ii];
+						clippedTriangles[s + 2] = _fan[ii + 1];
+						s += 3;
+					}
+					continue;
+				}
+			}
+
+			// The triangle is not clipped, keep its input vertices.
+			size_t s = clippedTriangles.size();
+			clippedTriangles.setSize(s + 3, 0);
+			for (int ii = 0; ii < 3; ii++)
+				clippedTriangles[s + ii] = sharedVertex(indices[ii], vertices, uvs, stride);
+			emitted = true;
+			break;
+		}
+		if (emitted && !clipped)
+			_acceptedCount++;
+		else if (clipped)
+			_clippedCount++;
+		else
+			_rejectedCount++;
+	}
+}
+
+bool SkeletonClipping::clipShared(size_t triangle, unsigned short *indices, float x1, float y1, float x2, float y2, float x3,
+								  float y3, size_t polygon) {
+	Vector<ClipVertex> *input = &_sharedInput, *output = &_sharedOutput;
+	bool clipped = false;
+
+	ClipVertex v1 = {x1, y1, indices[0], -1}, v2 = {x2, y2, indices[1], -2}, v3 = {x3, y3, indices[2], -3};
+	input->clear();
+	input->add(v1);
+	input->add(v2);
+	input->add(v3);
+	input->add(v1);
+	output->clear();
+
+	Vector<float> &clippingVertices = *(*_clippingPolygons)[polygon];
+	size_t clippingVerticesLast = clippingVertices.size() - 4;
+	int edge = _clippingEdges[polygon];
+	for (size_t i = 0;; i += 2, edge++) {
+		float edgeX = clippingVertices[i], edgeY = clippingVertices[i + 1];
+		float ex = edgeX - clippingVertices[i + 2], ey = edgeY - clippingVertices[i + 3];
+
+		size_t outputStart = output->size();
+		Vector<ClipVertex> &inputVertices = *input;
+		for (size_t ii = 0, nn = input->size() - 1; ii < nn; ii++) {
+			ClipVertex &a = inputVertices[ii], &b = inputVertices[ii + 1];
+			bool s2 = ey * (edgeX - b.x) > ex * (edgeY - b.y);
+			float s1 = ey * (edgeX - a.x) - ex * (edgeY - a.y);
+			if (s1 > 0) {
+				if (s2) {// v1 inside, v2 inside
+					output->add(b);
+					continue;
+				}
+				// v1 inside, v2 outside, the output continues along the clipping edge.
+				float ix = b.x - a.x, iy = b.y - a.y, t = s1 / (ix * ey - iy * ex);
+				ClipVertex v = b;
+				if (t >= 0 && t <= 1) {
+					v.x = a.x + ix * t;
+					v.y = a.y + iy * t;
+					v.key = intersectionKey(triangle, indices, a.line, edge);
+				}
+				v.line = edge;
+				output->add(v);
+			} else if (s2) {// v1 outside, v2 inside
+				float ix = b.x - a.x, iy = b.y - a.y, t = s1 / (ix * ey - iy * ex);
+				if (t >= 0 && t <= 1) {
+					ClipVertex v = {a.x + ix * t, a.y + iy * t, intersectionKey(triangle, indices, a.line, edge), a.line};
+					output->add(v);
+					output->add(b);
+				} else {
+					output->add(b);
+					continue;
+				}
+			}
+			clipped = true;
+		}
+
+		if (outputStart == output->size()) {
+			// All edges outside.
+			_sharedOutput.clear();
+			return true;
+		}
+
+		output->add((*output)[0]);
+
+		if (i == clippingVerticesLast) {
+			break;
+		}
+		Vector<ClipVertex> *temp = output;
+		output = input;
+		output->clear();
+		input = temp;
+	}
+
+	if (output != &_sharedOutput) _sharedOutput.clearAndAddAll(*output);
+	_sharedOutput.removeAt(_sharedOutput.size() - 1);
+
+	if (_sharedOutput.size() < 3) {
+		_sharedOutput.clear();
+		return false;
+	}
+	return clipped;
+}
+
+unsigned short SkeletonClipping::sharedVertex(int index, float *vertices, float *uvs, size_t stride) {
+	int id = _vertexIds[index];
+	if (id != -1) return (unsigned short) id;
+	id = (int) (_clippedVertices.size() >> 1);
+	_vertexIds[index] = id;
+	size_t offset = index * stride;
+	_clippedVertices.add(vertices[offset]);
+	_clippedVertices.add(vertices[offset + 1]);
+	if (uvs) {
+		_clippedUVs.add(uvs[offset]);
+		_clippedUVs.add(uvs[offset + 1]);
+	}
+	return (unsigned short) id;
+}
+
+unsigned short SkeletonClipping::sharedVertex(const ClipVertex &vertex, float *vertices, float *uvs, size_t stride,
+											  const TriangleUVs &triangle) {
+	if (vertex.key < (1ULL << 62)) return sharedVertex((int) vertex.key, vertices, uvs, stride);
+	int id = _edgeVertices.get(vertex.key, -1);
+	if (id != -1) return (unsigned short) id;
+	id = (int) (_clippedVertices.size() >> 1);
+	_edgeVertices.put(vertex.key, id);
+	_clippedVertices.add(vertex.x);
+	_clippedVertices.add(vertex.y);
+	if (uvs) {
+		float c0 = vertex.x - triangle.x3, c1 = vertex.y - triangle.y3;
+		float a = (triangle.d0 * c0 + triangle.d1 * c1) * triangle.d;
+		float b = (triangle.d4 * c0 + triangle.d2 * c1) * triangle.d;
+		float c = 1 - a - b;
+		_clippedUVs.add(triangle.u1 * a + triangle.u2 * b + triangle.u3 * c);
+		_clippedUVs.add(triangle.v1 * a + triangle.v2 * b + triangle.v3 * c);
+	}
+	return (unsigned short) id;
+}
+
+uint64_t SkeletonClipping::intersectionKey(size_t triangle, unsigned short *indices, int line, int edge) {
+	if (line < 0) {
+		// A triangle edge crossing a clipping edge, the same for the triangles on both sides of the triangle edge.
+		int e = -line - 1;
+		uint64_t a = indices[e], b = indices[e == 2 ? 0 : e + 1];
+		if (a > b) {
+			uint64_t temp = a;
+			a = b;
+			b = temp;
+		}
+		return (1ULL << 62) | ((uint64_t) edge << 32) | (b << 16) | a;
+	}
+	// A clipping edge crossing another, only within this triangle since UVs depend on the triangle.
+	return (2ULL << 62) | ((uint64_t) (edge & 0xffff) << 48) | ((uint64_t) (line & 0xffff) << 32) | (uint64_t) (triangle & 0xffffffff);
+}
+
 bool SkeletonClipping::clip(float x1, float y1, float x2, float y2, float x3, float y3, Vector<float> *clippingArea,
 							Vector<float> *output) {
 	Vector<float> *originalOutput = output;
@@ -38,6 +38,7 @@
 #include <spine/Skin.h>
 #include <spine/SlotData.h>
 #include <spine/TransformConstraintData.h>
+#include <spine/UpdateCacheProgram.h>
 
 #include <spine/ContainerUtil.h>
 
@@ -69,6 +70,7 @@ SkeletonData::~SkeletonData() {
 	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_physicsConstraints);
+	ContainerUtil::cleanUpVectorOfPointers(_updateCachePrograms);
 	for (size_t i = 0; i < _strings.size(); i++) {
 		SpineExtension::free(_strings[i], __FILE__, __LINE__);
 	}
@@ -242,3 +244,11 @@ float SkeletonData::getFps() {
 void SkeletonData::setFps(float inValue) {
 	_fps = inValue;
 }
+
+Vector<UpdateCacheProgram *> &SkeletonData::getUpdateCachePrograms() {
+	return _updateCachePrograms;
+}
+
+void SkeletonData::clearUpdateCachePrograms() {
+	ContainerUtil::cleanUpVectorOfPointers(_updateCachePrograms);
+}
@@ -102,10 +102,11 @@ static void toColor(Color &color, const char *value, bool hasAlpha) {
 }
 
 SkeletonJson::SkeletonJson(Atlas *atlas) : _attachmentLoader(new (__FILE__, __LINE__) AtlasAttachmentLoader(atlas)),
-										   _scale(1), _ownsLoader(true) {}
+										   _scale(1), _quantizationTolerance(0), _ownsLoader(true) {}
 
 SkeletonJson::SkeletonJson(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(attachmentLoader),
 																				  _scale(1),
+																				  _quantizationTolerance(0),
 																				  _ownsLoader(ownsLoader) {
 	assert(_attachmentLoader != NULL);
 }
@@ -844,6 +845,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 				delete root;
 				return NULL;
 			}
+			animation->_index = animationsIndex;
 			skeletonData->_animations[animationsIndex++] = animation;
 		}
 	}
@@ -1417,43 +1419,22 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 					String timelineName = timelineMap->_name;
 					if (timelineName == "deform") {
 						VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(attachment);
-						bool weighted = vertexAttachment->_bones.size() != 0;
-						Vector<float> &verts = vertexAttachment->_vertices;
-						int deformLength = weighted ? (int) verts.size() / 3 * 2 : (int) verts.size();
 
 						DeformTimeline *timeline = new (__FILE__, __LINE__) DeformTimeline(frames,
 																						   frames, slotIndex, vertexAttachment);
 						float time = Json::getFloat(keyMap, "time", 0);
+						Vector<float> deltas;
 						for (frame = 0, bezier = 0;; frame++) {
 							Json *vertices = Json::getItem(keyMap, "vertices");
-							Vector<float> deformed;
-							if (!vertices) {
-								if (weighted) {
-									deformed.setSize(deformLength, 0);
-								} else {
-									deformed.clearAndAddAll(vertexAttachment->_vertices);
-								}
-							} else {
-								deformed.setSize(deformLength, 0);
-								int v, start = Json::getInt(keyMap, "offset", 0);
-								Json *vertex;
-								if (_scale == 1) {
-									for (vertex = vertices->_child, v = start; vertex; vertex = vertex->_next, ++v) {
-										deformed[v] = vertex->_valueFloat;
-									}
-								} else {
-									for (vertex = vertices->_child, v = start; vertex; vertex = vertex->_next, ++v) {
-										deformed[v] = vertex->_valueFloat * _scale;
-									}
-								}
-								if (!weighted) {
-									Vector<float> &verticesAttachment = vertexAttachment->_vertices;
-									for (v = 0; v < deformLength; ++v) {
-										deformed[v] += verticesAttachment[v];
-									}
-								}
+							deltas.clear();
+							int start = 0;
+							if (vertices) {
+								start = Json::getInt(keyMap, "offset", 0);
+								deltas.ensureCapacity(vertices->_size);
+								for (Json *vertex = vertices->_child; vertex; vertex = vertex->_next)
+									deltas.add(_scale == 1 ? vertex->_valueFloat : vertex->_valueFloat * _scale);
 							}
-							timeline->setFrame(frame, time, deformed);
+							timeline->setFrame(frame, time, deltas, start);
 							nextMap = keyMap->_next;
 							if (!nextMap) {
 								// timeline.shrink(); // BOZO
@@ -1563,8 +1544,11 @@ Animation *SkeletonJson::readAnimation(Json *root, SkeletonData *skeletonData) {
 	}
 
 	float duration = 0;
-	for (size_t i = 0; i < timelines.size(); i++)
+	for (size_t i = 0; i < timelines.size(); i++) {
 		duration = MathUtil::max(duration, timelines[i]->getDuration());
+		if (_quantizationTolerance > 0 && timelines[i]->getRTTI().instanceOf(CurveTimeline1::rtti))
+			static_cast<CurveTimeline1 *>(timelines[i])->quantize(_quantizationTolerance);
+	}
 	return new (__FILE__, __LINE__) Animation(String(root->_name), timelines, duration);
 }
 
@@ -1609,6 +1593,7 @@ void SkeletonJson::readVertices(Json *attachmentMap, VertexAttachment *attachmen
 
 	attachment->getVertices().clearAndAddAll(bonesAndWeights._vertices);
 	attachment->getBones().clearAndAddAll(bonesAndWeights._bones);
+	attachment->updateSkinning();
 }
 
 void SkeletonJson::setError(Json *root, const String &value1, const String &value2) {
@@ -35,10 +35,12 @@
 #include <spine/MeshAttachment.h>
 #include <spine/ClippingAttachment.h>
 #include <spine/Bone.h>
+#include <limits.h>
 
 using namespace spine;
 
-SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quadIndices(), _clipping(), _renderCommands() {
+SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quadIndices(), _clipping(), _renderCommands(),
+									   _indexFormat(IndexFormat_UInt16), _maxBatchVertices(INT_MAX), _maxBatchIndices(INT_MAX) {
 	_quadIndices.add(0);
 	_quadIndices.add(1);
 	_quadIndices.add(2);
@@ -50,14 +52,20 @@ SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quad
 SkeletonRenderer::~SkeletonRenderer() {
 }
 
-static RenderCommand *createRenderCommand(BlockAllocator &allocator, int numVertices, int32_t numIndices, BlendMode blendMode, void *texture) {
+static RenderCommand *createRenderCommand(BlockAllocator &allocator, int numVertices, int32_t numIndices, BlendMode blendMode, void *texture, IndexFormat indexFormat = IndexFormat_UInt16) {
 	RenderCommand *cmd = allocator.allocate<RenderCommand>(1);
 	cmd->positions = allocator.allocate<float>(numVertices << 1);
 	cmd->uvs = allocator.allocate<float>(numVertices << 1);
 	cmd->colors = allocator.allocate<uint32_t>(numVertices);
 	cmd->darkColors = allocator.allocate<uint32_t>(numVertices);
 	cmd->numVertices = numVertices;
-	cmd->indices = allocator.allocate<uint16_t>(numIndices);
+	if (indexFormat == IndexFormat_UInt32) {
+		cmd->indices = nullptr;
+		cmd->indices32 = allocator.allocate<uint32_t>(numIndices);
+	} else {
+		cmd->indices = allocator.allocate<uint16_t>(numIndices);
+		cmd->indices32 = nullptr;
+	}
 	cmd->numIndices = numIndices;
 	cmd->blendMode = blendMode;
 	cmd->texture = texture;
@@ -65,13 +73,14 @@ static RenderCommand *createRenderCommand(BlockAllocator &allocator, int numVert
 	return cmd;
 }
 
-static RenderCommand *batchSubCommands(BlockAllocator &allocator, Vector<RenderCommand *> &commands, int first, int last, int numVertices, int numIndices) {
-	RenderCommand *batched = createRenderCommand(allocator, numVertices, numIndices, commands[first]->blendMode, commands[first]->texture);
+static RenderCommand *batchSubCommands(BlockAllocator &allocator, Vector<RenderCommand *> &commands, int first, int last, int numVertices, int numIndices, IndexFormat indexFormat) {
+	RenderCommand *batched = createRenderCommand(allocator, numVertices, numIndices, commands[first]->blendMode, commands[first]->texture, indexFormat);
 	float *positions = batched->positions;
 	float *uvs = batched->uvs;
 	uint32_t *colors = batched->colors;
 	uint32_t *darkColors = batched->darkColors;
 	uint16_t *indices = batched->indices;
+	uint32_t *indices32 = batched->indices32;
 	int indicesOffset = 0;
 	for (int i = first; i <= last; i++) {
 		RenderCommand *cmd = commands[i];
@@ -79,19 +88,25 @@ static RenderCommand *batchSubCommands(BlockAllocator &allocator, Vector<RenderC
 		memcpy(uvs, cmd->uvs, sizeof(float) * 2 * cmd->numVertices);
 		memcpy(colors, cmd->colors, sizeof(int32_t) * cmd->numVertices);
 		memcpy(darkColors, cmd->darkColors, sizeof(int32_t) * cmd->numVertices);
-		for (int ii = 0; ii < cmd->numIndices; ii++)
-			indices[ii] = cmd->indices[ii] + indicesOffset;
+		if (indices32) {
+			for (int ii = 0; ii < cmd->numIndices; ii++)
+				indices32[ii] = cmd->indices[ii] + indicesOffset;
+			indices32 += cmd->numIndices;
+		} else {
+			for (int ii = 0; ii < cmd->numIndices; ii++)
+				indices[ii] = cmd->indices[ii] + indicesOffset;
+			indices += cmd->numIndices;
+		}
 		indicesOffset += cmd->numVertices;
 		positions += 2 * cmd->numVertices;
 		uvs += 2 * cmd->numVertices;
 		colors += cmd->numVertices;
 		darkColors += cmd->numVertices;
-		indices += cmd->numIndices;
 	}
 	return batched;
 }
 
-static RenderCommand *batchCommands(BlockAllocator &allocator, Vector<RenderCommand *> &commands) {
+static RenderCommand *batchCommands(BlockAllocator &allocator, Vector<RenderCommand *> &commands, IndexFormat indexFormat, int maxVertices, int maxIndices) {
 	if (commands.size() == 0) return nullptr;
 
 	RenderCommand *root = nullptr;
@@ -114,11 +129,12 @@ static RenderCommand *batchCommands(BlockAllocator &allocator, Vector<RenderComm
 			cmd->blendMode == first->blendMode &&
 			cmd->colors[0] == first->colors[0] &&
 			cmd->darkColors[0] == first->darkColors[0] &&
-			numIndices + cmd->numIndices < 0xffff) {
+			(indexFormat == IndexFormat_UInt32 || numIndices + cmd->numIndices < 0xffff) &&
+			numVertices + cmd->numVertices <= maxVertices && numIndices + cmd->numIndices <= maxIndices) {
 			numVertices += cmd->numVertices;
 			numIndices += cmd->numIndices;
 		} else {
-			RenderCommand *batched = batchSubCommands(allocator, commands, startIndex, i - 1, numVertices, numIndices);
+			RenderCommand *batched = batchSubCommands(allocator, commands, startIndex, i - 1, numVertices, numIndices, indexFormat);
 			if (!last) {
 				root = last = batched;
 			} else {
@@ -136,111 +152,440 @@ static RenderCommand *batchCommands(BlockAllocator &allocator, Vector<RenderComm
 	return root;
 }
 
+bool SkeletonRenderer::prepare(Skeleton &skeleton, Slot &slot, const SkeletonTransform *transform, SlotGeometry &geometry) {
+	SkeletonClipping &clipper = _clipping;
+	Attachment *attachment = slot.getAttachment();
+	if (!attachment) {
+		clipper.clipEnd(slot);
+		return false;
+	}
+
+	// Early out if the slot color is 0 or the bone is not active
+	if ((slot.getColor().a == 0 || !slot.getBone().isActive()) && !attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+		clipper.clipEnd(slot);
+		return false;
+	}
+
+	Vector<float> *worldVertices = &_worldVertices;
+	Vector<unsigned short> *quadIndices = &_quadIndices;
+	Vector<float> *vertices = worldVertices;
+	int32_t verticesCount;
+	Vector<float> *uvs;
+	Vector<unsigned short> *indices;
+	int32_t indicesCount;
+	Color *attachmentColor;
+	void *texture;
+
+	if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+		RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
+		attachmentColor = &regionAttachment->getColor();
+
+		// Early out if the slot color is 0
+		if (attachmentColor->a == 0) {
+			clipper.clipEnd(slot);
+			return false;
+		}
+
+		worldVertices->setSize(8, 0);
+		regionAttachment->computeWorldVertices(slot, *worldVertices, 0, 2);
+		verticesCount = 4;
+		uvs = &regionAttachment->getUVs();
+		indices = quadIndices;
+		indicesCount = 6;
+		texture = regionAttachment->getRegion()->rendererObject;
+
+	} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+		MeshAttachment *mesh = (MeshAttachment *) attachment;
+		attachmentColor = &mesh->getColor();
+
+		// Early out if the slot color is 0
+		if (attachmentColor->a == 0) {
+			clipper.clipEnd(slot);
+			return false;
+		}
+
+		worldVertices->setSize(mesh->getWorldVerticesLength(), 0);
+		mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices->buffer(), 0, 2);
+		verticesCount = (int32_t) (mesh->getWorldVerticesLength() >> 1);
+		uvs = &mesh->getUVs();
+		indices = &mesh->getTriangles();
+		indicesCount = (int32_t) indices->size();
+		texture = mesh->getRegion()->rendererObject;
+
+	} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+		ClippingAttachment *clip = (ClippingAttachment *) slot.getAttachment();
+		clipper.clipStart(slot, clip);
+		return false;
+	} else
+		return false;
+
+	uint8_t r = static_cast<uint8_t>(skeleton.getColor().r * slot.getColor().r * attachmentColor->r * 255);
+	uint8_t g = static_cast<uint8_t>(skeleton.getColor().g * slot.getColor().g * attachmentColor->g * 255);
+	uint8_t b = static_cast<uint8_t>(skeleton.getColor().b * slot.getColor().b * attachmentColor->b * 255);
+	uint8_t a = static_cast<uint8_t>(skeleton.getColor().a * slot.getColor().a * attachmentColor->a * 255);
+	uint32_t color = (a << 24) | (r << 16) | (g << 8) | b;
+	uint32_t darkColor = 0xff000000;
+	if (slot.hasDarkColor()) {
+		Color &slotDarkColor = slot.getDarkColor();
+		darkColor = 0xff000000 | (static_cast<uint8_t>(slotDarkColor.r * 255) << 16) | (static_cast<uint8_t>(slotDarkColor.g * 255) << 8) | static_cast<uint8_t>(slotDarkColor.b * 255);
+	}
+
+	if (clipper.isClipping()) {
+		clipper.clipTriangles(*worldVertices, *indices, *uvs, 2);
+		vertices = &clipper.getClippedVertices();
+		verticesCount = (int32_t) (clipper.getClippedVertices().size() >> 1);
+		uvs = &clipper.getClippedUVs();
+		indices = &clipper.getClippedTriangles();
+		indicesCount = (int32_t) (clipper.getClippedTriangles().size());
+	}
+
+	if (transform) {
+		float a = transform->a, b = transform->b, c = transform->c, d = transform->d, x = transform->x, y = transform->y;
+		float *positions = vertices->buffer();
+		for (int i = 0, n = verticesCount << 1; i < n; i += 2) {
+			float vx = positions[i], vy = positions[i + 1];
+			positions[i] = a * vx + b * vy + x;
+			positions[i + 1] = c * vx + d * vy + y;
+		}
+	}
+
+	geometry.positions = vertices->buffer();
+	geometry.uvs = uvs->buffer();
+	geometry.indices = indices->buffer();
+	geometry.numVertices = verticesCount;
+	geometry.numIndices = indicesCount;
+	geometry.color = color;
+	geometry.darkColor = darkColor;
+	geometry.blendMode = slot.getData().getBlendMode();
+	geometry.texture = texture;
+	return true;
+}
+
 RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
+	Skeleton *skeletons = &skeleton;
+	return render(&skeletons, NULL, 1);
+}
+
+RenderCommand *SkeletonRenderer::render(Vector<Skeleton *> &skeletons, Vector<SkeletonTransform> *transforms) {
+	assert(!transforms || transforms->size() == skeletons.size());
+	return render(skeletons.buffer(), transforms ? transforms->buffer() : NULL, (int) skeletons.size());
+}
+
+RenderCommand *SkeletonRenderer::render(Skeleton **skeletons, SkeletonTransform *transforms, int count) {
 	_allocator.compress();
 	_renderCommands.clear();
 
 	SkeletonClipping &clipper = _clipping;
+	SlotGeometry geometry;
+	for (int s = 0; s < count; s++) {
+		Skeleton &skeleton = *skeletons[s];
+		SkeletonTransform *transform = transforms ? transforms + s : NULL;
+		for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
+			Slot &slot = *skeleton.getDrawOrder()[i];
+			if (!prepare(skeleton, slot, transform, geometry)) continue;
 
-	for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
-		Slot &slot = *skeleton.getDrawOrder()[i];
-		Attachment *attachment = slot.getAttachment();
-		if (!attachment) {
+			int32_t verticesCount = geometry.numVertices;
+			RenderCommand *cmd = createRenderCommand(_allocator, verticesCount, geometry.numIndices, geometry.blendMode, geometry.texture);
+			_renderCommands.add(cmd);
+			memcpy(cmd->positions, geometry.positions, (verticesCount << 1) * sizeof(float));
+			memcpy(cmd->uvs, geometry.uvs, (verticesCount << 1) * sizeof(float));
+			for (int ii = 0; ii < verticesCount; ii++) {
+				cmd->colors[ii] = geometry.color;
+				cmd->darkColors[ii] = geometry.darkColor;
+			}
+			memcpy(cmd->indices, geometry.indices, geometry.numIndices * sizeof(uint16_t));
 			clipper.clipEnd(slot);
-			continue;
 		}
+		clipper.clipEnd();
+	}
 
-		// Early out if the slot color is 0 or the bone is not active
-		if ((slot.getColor().a == 0 || !slot.getBone().isActive()) && !attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
-			clipper.clipEnd(slot);
-			continue;
-		}
+	return batchCommands(_allocator, _renderCommands, _indexFormat, _maxBatchVertices, _maxBatchIndices);
+}
 
-		Vector<float> *worldVertices = &_worldVertices;
-		Vector<unsigned short> *quadIndices = &_quadIndices;
-		Vector<float> *vertices = worldVertices;
-		int32_t verticesCount;
-		Vector<float> *uvs;
-		Vector<unsigned short> *indices;
-		int32_t indicesCount;
-		Color *attachmentColor;
-		void *texture;
-
-		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
-			RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
-			attachmentColor = &regionAttachment->getColor();
-
-			// Early out if the slot color is 0
-			if (attachmentColor->a == 0) {
-				clipper.clipEnd(slot);
-				continue;
+IndexFormat SkeletonRenderer::getIndexFormat() {
+	return _indexFormat;
+}
+
+void SkeletonRenderer::setIndexFormat(IndexFormat format) {
+	_indexFormat = format;
+}
+
+int SkeletonRenderer::getMaxBatchVertices() {
+	return _maxBatchVertices;
+}
+
+void SkeletonRenderer::setMaxBatchVertices(int maxBatchVertices) {
+	assert(maxBatchVertices > 0);
+	_maxBatchVertices = maxBatchVertices;
+}
+
+int SkeletonRenderer::getMaxBatchIndices() {
+	return _maxBatchIndices;
+}
+
+void SkeletonRenderer::setMaxBatchIndices(int maxBatchIndices) {
+	assert(maxBatchIndices > 0);
+	_maxBatchIndices = maxBatchIndices;
+}
+
+SkeletonClipping &SkeletonRenderer::getClipping() {
+	return _clipping;
+}
+
+static inline uint32_t convertColor(uint32_t argb, VertexColorFormat format) {
+	if (format == VertexColorFormat_ABGR) return (argb & 0xff00ff00) | ((argb & 0x00ff0000) >> 16) | ((argb & 0x000000ff) << 16);
+	return argb;
+}
+
+/// Writes the vertices of a slot in the layout of the buffer's interleaved array.
+static void writeInterleaved(uint8_t *vertices, const VertexLayout &layout, const float *positions, const float *uvs,
+							 uint32_t color, uint32_t darkColor, int count) {
+	int stride = layout.stride;
+	if (layout.positionOffset >= 0) {
+		uint8_t *vertex = vertices + layout.positionOffset;
+		for (int i = 0; i < count; i++, vertex += stride)
+			memcpy(vertex, positions + (i << 1), sizeof(float) * 2);
+	}
+	if (layout.uvOffset >= 0) {
+		uint8_t *vertex = vertices + layout.uvOffset;
+		if (layout.uvFormat == VertexUVFormat_UNorm16) {
+			for (int i = 0; i < count; i++, vertex += stride) {
+				uint16_t uv[2];
+				for (int ii = 0; ii < 2; ii++) {
+					float value = uvs[(i << 1) + ii];
+					uv[ii] = (uint16_t) (MathUtil::clamp(value, 0.0f, 1.0f) * 65535 + 0.5f);
+				}
+				memcpy(vertex, uv, sizeof(uv));
 			}
+		} else {
+			for (int i = 0; i < count; i++, vertex += stride)
+				memcpy(vertex, uvs + (i << 1), sizeof(float) * 2);
+		}
+	}
+	if (layout.colorOffset >= 0) {
+		uint32_t value = convertColor(color, layout.colorFormat);
+		uint8_t *vertex = vertices + layout.colorOffset;
+		for (int i = 0; i < count; i++, vertex += stride)
+			memcpy(vertex, &value, sizeof(uint32_t));
+	}
+	if (layout.darkColorOffset >= 0) {
+		uint32_t value = convertColor(darkColor, layout.colorFormat);
+		uint8_t *vertex = vertices + layout.darkColorOffset;
+		for (int i = 0; i < count; i++, vertex += stride)
+			memcpy(vertex, &value, sizeof(uint32_t));
+	}
+}
 
-			worldVertices->setSize(8, 0);
-			regionAttachment->computeWorldVertices(slot, *worldVertices, 0, 2);
-			verticesCount = 4;
-			uvs = &regionAttachment->getUVs();
-			indices = quadIndices;
-			indicesCount = 6;
-			texture = regionAttachment->getRegion()->rendererObject;
+void SkeletonRenderer::render(Skeleton &skeleton, RenderBuffer &buffer) {
+	Skeleton *skeletons = &skeleton;
+	render(&skeletons, NULL, 1, buffer);
+}
+
+void SkeletonRenderer::render(Vector<Skeleton *> &skeletons, Vector<SkeletonTransform> *transforms, RenderBuffer &buffer) {
+	assert(!transforms || transforms->size() == skeletons.size());
+	render(skeletons.buffer(), transforms ? transforms->buffer() : NULL, (int) skeletons.size(), buffer);
+}
 
-		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
-			MeshAttachment *mesh = (MeshAttachment *) attachment;
-			attachmentColor = &mesh->getColor();
+void SkeletonRenderer::render(Skeleton **skeletons, SkeletonTransform *transforms, int count, RenderBuffer &buffer) {
+	bool interleaved = buffer._vertices != NULL;
+	assert((interleaved || (buffer._positions && buffer._uvs && buffer._colors)) && (buffer._indices || buffer._indices32));
+	bool indices32 = buffer._indices32 != NULL;
+	// Batches compare colors of their first vertex, interleaved batches keep them here.
+	uint32_t batchColor = 0, batchDarkColor = 0;
+	bool darkColors = interleaved ? buffer._layout.darkColorOffset >= 0 : buffer._darkColors != NULL;
 
-			// Early out if the slot color is 0
-			if (attachmentColor->a == 0) {
+	SkeletonClipping &clipper = _clipping;
+	SlotGeometry geometry;
+	// The batch being written: [batchVertex, vertexCount) and [batchIndex, indexCount) of the buffer.
+	RenderCommand batch;
+	int batchVertex = buffer._vertexCount, batchIndex = buffer._indexCount;
+	bool batching = false;
+	for (int s = 0; s < count; s++) {
+		Skeleton &skeleton = *skeletons[s];
+		SkeletonTransform *transform = transforms ? transforms + s : NULL;
+		for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
+			Slot &slot = *skeleton.getDrawOrder()[i];
+			if (!prepare(skeleton, slot, transform, geometry)) continue;
+			int32_t verticesCount = geometry.numVertices, indicesCount = geometry.numIndices;
+			if (verticesCount == 0 && indicesCount == 0) {
 				clipper.clipEnd(slot);
 				continue;
 			}
 
-			worldVertices->setSize(mesh->getWorldVerticesLength(), 0);
-			mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices->buffer(), 0, 2);
-			verticesCount = (int32_t) (mesh->getWorldVerticesLength() >> 1);
-			uvs = &mesh->getUVs();
-			indices = &mesh->getTriangles();
-			indicesCount = (int32_t) indices->size();
-			texture = mesh->getRegion()->rendererObject;
-
-		} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
-			ClippingAttachment *clip = (ClippingAttachment *) slot.getAttachment();
-			clipper.clipStart(slot, clip);
-			continue;
-		} else
-			continue;
+			bool fits = buffer._vertexCount + verticesCount <= buffer._maxVertices &&
+						buffer._indexCount + indicesCount <= buffer._maxIndices;
+			if (batching && (!fits || geometry.texture != batch.texture || geometry.blendMode != batch.blendMode ||
+							 geometry.color != batchColor || (darkColors && geometry.darkColor != batchDarkColor) ||
+							 (!indices32 && (buffer._indexCount - batchIndex) + indicesCount >= 0xffff) ||
+							 (buffer._vertexCount - batchVertex) + verticesCount > _maxBatchVertices ||
+							 (buffer._indexCount - batchIndex) + indicesCount > _maxBatchIndices)) {
+				batch.numVertices = buffer._vertexCount - batchVertex;
+				batch.numIndices = buffer._indexCount - batchIndex;
+				buffer.draw(batch, batchVertex, batchIndex);
+				batching = false;
+			}
+			if (!fits) {
+				buffer.flush(verticesCount, indicesCount);
+				buffer._vertexCount = 0;
+				buffer._indexCount = 0;
+				if (verticesCount > buffer._maxVertices || indicesCount > buffer._maxIndices) {
+					// The attachment does not fit even in the empty arrays.
+					clipper.clipEnd(slot);
+					continue;
+				}
+			}
+			if (!batching) {
+				batchVertex = buffer._vertexCount;
+				batchIndex = buffer._indexCount;
+				if (interleaved) {
+					batch.positions = NULL;
+					batch.uvs = NULL;
+					batch.colors = NULL;
+					batch.darkColors = NULL;
+				} else {
+					batch.positions = buffer._positions + (batchVertex << 1);
+					batch.uvs = buffer._uvs + (batchVertex << 1);
+					batch.colors = buffer._colors + batchVertex;
+					batch.darkColors = buffer._darkColors ? buffer._darkColors + batchVertex : NULL;
+				}
+				batchColor = geometry.color;
+				batchDarkColor = geometry.darkColor;
+				batch.indices = indices32 ? NULL : buffer._indices + batchIndex;
+				batch.indices32 = indices32 ? buffer._indices32 + batchIndex : NULL;
+				batch.blendMode = geometry.blendMode;
+				batch.texture = geometry.texture;
+				batch.next = NULL;
+				batching = true;
+			}
 
-		uint8_t r = static_cast<uint8_t>(skeleton.getColor().r * slot.getColor().r * attachmentColor->r * 255);
-		uint8_t g = static_cast<uint8_t>(skeleton.getColor().g * slot.getColor().g * attachmentColor->g * 255);
-		uint8_t b = static_cast<uint8_t>(skeleton.getColor().b * slot.getColor().b * attachmentColor->b * 255);
-		uint8_t a = static_cast<uint8_t>(skeleton.getColor().a * slot.getColor().a * attachmentColor->a * 255);
-		uint32_t color = (a << 24) | (r << 16) | (g << 8) | b;
-		uint32_t darkColor = 0xff000000;
-		if (slot.hasDarkColor()) {
-			Color &slotDarkColor = slot.getDarkColor();
-			darkColor = 0xff000000 | (static_cast<uint8_t>(slotDarkColor.r * 255) << 16) | (static_cast<uint8_t>(slotDarkColor.g * 255) << 8) | static_cast<uint8_t>(slotDarkColor.b * 255);
+			int vertexCount = buffer._vertexCount;
+			if (interleaved) {
+				writeInterleaved(buffer._vertices + vertexCount * buffer._layout.stride, buffer._layout, geometry.positions,
+								 geometry.uvs, geometry.color, geometry.darkColor, verticesCount);
+			} else {
+				memcpy(buffer._positions + (vertexCount << 1), geometry.positions, (verticesCount << 1) * sizeof(float));
+				memcpy(buffer._uvs + (vertexCount << 1), geometry.uvs, (verticesCount << 1) * sizeof(float));
+				uint32_t *colors = buffer._colors + vertexCount;
+				for (int ii = 0; ii < verticesCount; ii++)
+					colors[ii] = geometry.color;
+				if (buffer._darkColors) {
+					uint32_t *darkColors = buffer._darkColors + vertexCount;
+					for (int ii = 0; ii < verticesCount; ii++)
+						darkColors[ii] = geometry.darkColor;
+				}
+			}
+			if (indices32) {
+				uint32_t *indices = buffer._indices32 + buffer._indexCount;
+				uint32_t offset = (uint32_t) (vertexCount - batchVertex);
+				for (int ii = 0; ii < indicesCount; ii++)
+					indices[ii] = geometry.indices[ii] + offset;
+			} else {
+				uint16_t *indices = buffer._indices + buffer._indexCount;
+				uint16_t offset = (uint16_t) (vertexCount - batchVertex);
+				for (int ii = 0; ii < indicesCount; ii++)
+					indices[ii] = geometry.indices[ii] + offset;
+			}
+			buffer._vertexCount += verticesCount;
+			buffer._indexCount += indicesCount;
+			clipper.clipEnd(slot);
 		}
+		clipper.clipEnd();
+	}
 
-		if (clipper.isClipping()) {
-			clipper.clipTriangles(*worldVertices, *indices, *uvs, 2);
-			vertices = &clipper.getClippedVertices();
-			verticesCount = (int32_t) (clipper.getClippedVertices().size() >> 1);
-			uvs = &clipper.getClippedUVs();
-			indices = &clipper.getClippedTriangles();
-			indicesCount = (int32_t) (clipper.getClippedTriangles().size());
-		}
+	if (batching) {
+		batch.numVertices = buffer._vertexCount - batchVertex;
+		batch.numIndices = buffer._indexCount - batchIndex;
+		buffer.draw(batch, batchVertex, batchIndex);
+	}
+}
+
+void SkeletonRenderer::measure(Skeleton &skeleton, int &numVertices, int &numIndices) {
+	Skeleton *skeletons = &skeleton;
+	measure(&skeletons, 1, numVertices, numIndices);
+}
 
-		RenderCommand *cmd = createRenderCommand(_allocator, verticesCount, indicesCount, slot.getData().getBlendMode(), texture);
-		_renderCommands.add(cmd);
-		memcpy(cmd->positions, vertices->buffer(), (verticesCount << 1) * sizeof(float));
-		memcpy(cmd->uvs, uvs->buffer(), (verticesCount << 1) * sizeof(float));
-		for (int ii = 0; ii < verticesCount; ii++) {
-			cmd->colors[ii] = color;
-			cmd->darkColors[ii] = darkColor;
+void SkeletonRenderer::measure(Vector<Skeleton *> &skeletons, int &numVertices, int &numIndices) {
+	measure(skeletons.buffer(), (int) skeletons.size(), numVertices, numIndices);
+}
+
+void SkeletonRenderer::measure(Skeleton **skeletons, int count, int &numVertices, int &numIndices) {
+	numVertices = 0;
+	numIndices = 0;
+	SkeletonClipping &clipper = _clipping;
+	SlotGeometry geometry;
+	for (int s = 0; s < count; s++) {
+		Skeleton &skeleton = *skeletons[s];
+		for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
+			Slot &slot = *skeleton.getDrawOrder()[i];
+			if (!prepare(skeleton, slot, NULL, geometry)) continue;
+			numVertices += geometry.numVertices;
+			numIndices += geometry.numIndices;
+			clipper.clipEnd(slot);
 		}
-		memcpy(cmd->indices, indices->buffer(), indices->size() * sizeof(uint16_t));
-		clipper.clipEnd(slot);
+		clipper.clipEnd();
 	}
-	clipper.clipEnd();
+}
+
+RenderBuffer::RenderBuffer() : _positions(NULL), _uvs(NULL), _colors(NULL), _darkColors(NULL), _vertices(NULL),
+							   _layout(0, -1, -1, -1, -1), _indices(NULL), _indices32(NULL),
+							   _maxVertices(0), _maxIndices(0), _vertexCount(0), _indexCount(0) {
+}
+
+RenderBuffer::~RenderBuffer() {
+}
+
+void RenderBuffer::setVertices(float *positions, float *uvs, uint32_t *colors, uint32_t *darkColors, int maxVertices) {
+	_positions = positions;
+	_uvs = uvs;
+	_colors = colors;
+	_darkColors = darkColors;
+	_vertices = NULL;
+	_maxVertices = maxVertices;
+	_vertexCount = 0;
+	_indexCount = 0;
+}
+
+void RenderBuffer::setVertices(void *vertices, const VertexLayout &layout, int maxVertices) {
+	assert(layout.positionOffset >= 0 && layout.stride > 0);
+	_positions = NULL;
+	_uvs = NULL;
+	_colors = NULL;
+	_darkColors = NULL;
+	_vertices = (uint8_t *) vertices;
+	_layout = layout;
+	_maxVertices = maxVertices;
+	_vertexCount = 0;
+	_indexCount = 0;
+}
+
+void RenderBuffer::setIndices(uint16_t *indices, int maxIndices) {
+	_indices = indices;
+	_indices32 = NULL;
+	_maxIndices = maxIndices;
+	_vertexCount = 0;
+	_indexCount = 0;
+}
+
+void RenderBuffer::setIndices(uint32_t *indices, int maxIndices) {
+	_indices = NULL;
+	_indices32 = indices;
+	_maxIndices = maxIndices;
+	_vertexCount = 0;
+	_indexCount = 0;
+}
 
-	return batchCommands(_allocator, _renderCommands);
-}
\ No newline at end of file
+int RenderBuffer::getMaxVertices() {
+	return _maxVertices;
+}
+
+int RenderBuffer::getMaxIndices() {
+	return _maxIndices;
+}
+
+int RenderBuffer::getVertexCount() {
+	return _vertexCount;
+}
+
+int RenderBuffer::getIndexCount() {
+	return _indexCount;
+}
@@ -0,0 +1,486 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonWorld.h>
+
+#include <spine/AnimationState.h>
+#include <spine/Bone.h>
+#include <spine/MathUtil.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonRenderer.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+#include <spine/WorkStealingPool.h>
+
+#include <float.h>
+
+using namespace spine;
+
+SkeletonWorldInstance::SkeletonWorldInstance(SkeletonData *skeletonData, AnimationStateData *stateData)
+	: _skeleton(new (__FILE__, __LINE__) Skeleton(skeletonData)),
+	  _state(new (__FILE__, __LINE__) AnimationState(stateData)), _renderer(NULL), _renderCommands(NULL),
+	  _active(true), _source(NULL), _updateInterval(1), _priority(1), _interpolateBones(false), _interpolateVertices(false),
+	  _updated(false), _posed(false), _skippedUpdates(0), _pendingDelta(0), _updateDelta(0), _elapsed(0) {
+}
+
+SkeletonWorldInstance::~SkeletonWorldInstance() {
+	delete _renderer;
+	delete _state;
+	delete _skeleton;
+}
+
+Skeleton &SkeletonWorldInstance::getSkeleton() {
+	return *_skeleton;
+}
+
+AnimationState &SkeletonWorldInstance::getAnimationState() {
+	return *_state;
+}
+
+RenderCommand *SkeletonWorldInstance::getRenderCommands() {
+	return _renderCommands;
+}
+
+bool SkeletonWorldInstance::isActive() {
+	return _active;
+}
+
+void SkeletonWorldInstance::setActive(bool inValue) {
+	_active = inValue;
+}
+
+int SkeletonWorldInstance::getUpdateInterval() {
+	return _updateInterval;
+}
+
+void SkeletonWorldInstance::setUpdateInterval(int inValue) {
+	assert(inValue >= 1);
+	_updateInterval = inValue;
+}
+
+float SkeletonWorldInstance::getPriority() {
+	return _priority;
+}
+
+void SkeletonWorldInstance::setPriority(float inValue) {
+	_priority = inValue;
+}
+
+bool SkeletonWorldInstance::getInterpolateBones() {
+	return _interpolateBones;
+}
+
+void SkeletonWorldInstance::setInterpolateBones(bool inValue) {
+	_interpolateBones = inValue;
+	_currentBones.clear();
+	_currentVertices.clear();
+}
+
+bool SkeletonWorldInstance::getInterpolateVertices() {
+	return _interpolateVertices;
+}
+
+void SkeletonWorldInstance::setInterpolateVertices(bool inValue) {
+	_interpolateVertices = inValue;
+	_currentVertices.clear();
+}
+
+SkeletonWorldInstance *SkeletonWorldInstance::getSource() {
+	return _source;
+}
+
+void SkeletonWorldInstance::setSource(SkeletonWorldInstance *source) {
+	assert(source != this && (source == NULL || source->_source == NULL));
+	assert(source == NULL || source->_skeleton->getData() == _skeleton->getData());
+	_source = source;
+}
+
+bool SkeletonWorldInstance::wasUpdated() {
+	return _updated;
+}
+
+void SkeletonWorldInstance::update(float delta, Physics physics, bool render) {
+	float time = _pendingDelta;
+	_pendingDelta = 0;
+	_skippedUpdates = 0;
+	_state->update(time);
+	_state->apply(*_skeleton);
+	_skeleton->update(time);
+	_skeleton->updateWorldTransform(physics);
+	if (render) {
+		if (!_renderer) _renderer = new (__FILE__, __LINE__) SkeletonRenderer();
+		_renderCommands = _renderer->render(*_skeleton);
+	} else
+		_renderCommands = NULL;
+	_posed = true;
+
+	_updateDelta = time;
+	_elapsed = delta;
+	storePose();
+	if (_elapsed < _updateDelta) showPose();
+}
+
+void SkeletonWorldInstance::share(bool render) {
+	Skeleton &source = *_source->_skeleton, &skeleton = *_skeleton;
+
+	// Maps the source's world transforms from its skeleton position and scale to this skeleton's.
+	float kx = source._scaleX != 0 ? skeleton._scaleX / source._scaleX : 0;
+	float ky = source._scaleY != 0 ? skeleton._scaleY / source._scaleY : 0;
+	float sx = source._x, sy = source._y, x = skeleton._x, y = skeleton._y;
+	Vector<Bone *> &sourceBones = source._bones, &bones = skeleton._bones;
+	for (size_t i = 0, n = bones.size(); i < n; i++) {
+		Bone *from = sourceBones[i], *to = bones[i];
+		to->_x = from->_x;
+		to->_y = from->_y;
+		to->_rotation = from->_rotation;
+		to->_scaleX = from->_scaleX;
+		to->_scaleY = from->_scaleY;
+		to->_shearX = from->_shearX;
+		to->_shearY = from->_shearY;
+		to->_ax = from->_ax;
+		to->_ay = from->_ay;
+		to->_arotation = from->_arotation;
+		to->_ascaleX = from->_ascaleX;
+		to->_ascaleY = from->_ascaleY;
+		to->_ashearX = from->_ashearX;
+		to->_ashearY = from->_ashearY;
+		to->_a = from->_a * kx;
+		to->_b = from->_b * kx;
+		to->_worldX = (from->_worldX - sx) * kx + x;
+		to->_c = from->_c * ky;
+		to->_d = from->_d * ky;
+		to->_worldY = (from->_worldY - sy) * ky + y;
+		to->_modified = true;
+	}
+
+	Vector<Slot *> &sourceSlots = source._slots, &slots = skeleton._slots;
+	for (size_t i = 0, n = slots.size(); i < n; i++) {
+		Slot *from = sourceSlots[i], *to = slots[i];
+		to->_color.set(from->_color);
+		to->_darkColor.set(from->_darkColor);
+		to->_attachment = from->_attachment;
+		to->_attachmentState = from->_attachmentState;
+		to->_sequenceIndex = from->_sequenceIndex;
+		if (from->_deform.size() > 0 || to->_deform.size() > 0) to->_deform.clearAndAddAll(from->_deform);
+	}
+	Vector<Slot *> &sourceDrawOrder = source._drawOrder, &drawOrder = skeleton._drawOrder;
+	for (size_t i = 0, n = drawOrder.size(); i < n; i++)
+		drawOrder[i] = slots[sourceDrawOrder[i]->_data.getIndex()];
+
+	if (render) {
+		if (!_renderer) _renderer = new (__FILE__, __LINE__) SkeletonRenderer();
+		_renderCommands = _renderer->render(skeleton);
+	} else
+		_renderCommands = NULL;
+	_posed = true;
+}
+
+void SkeletonWorldInstance::interpolate(float delta) {
+	_elapsed += delta;
+	showPose();
+}
+
+void SkeletonWorldInstance::storePose() {
+	if (_interpolateBones) {
+		Vector<Bone *> &bones = _skeleton->getBones();
+		size_t boneCount = bones.size(), n = boneCount * 6;
+		bool first = _currentBones.size() != n;
+		_previousBones.setSize(n, 0);
+		_currentBones.setSize(n, 0);
+		float *previous = _previousBones.buffer(), *current = _currentBones.buffer();
+		if (!first) {
+			for (size_t i = 0; i < n; i++)
+				previous[i] = current[i];
+		}
+		for (size_t i = 0; i < boneCount; i++, current += 6) {
+			Bone *bone = bones[i];
+			current[0] = bone->_a;
+			current[1] = bone->_b;
+			current[2] = bone->_c;
+			current[3] = bone->_d;
+			current[4] = bone->_worldX;
+			current[5] = bone->_worldY;
+		}
+		if (first) {
+			current = _currentBones.buffer();
+			for (size_t i = 0; i < n; i++)
+				previous[i] = current[i];
+		}
+	}
+
+	// The render commands are interpolated with the bones, so they show the same pose.
+	if ((_interpolateVertices || _interpolateBones) && _renderCommands) {
+		size_t n = 0;
+		for (RenderCommand *command = _renderCommands; command; command = command->next)
+			n += command->numVertices << 1;
+		// Vertices are only interpolated between renders with the same number of vertices.
+		bool first = _currentVertices.size() != n;
+		_previousVertices.setSize(n, 0);
+		_currentVertices.setSize(n, 0);
+		float *previous = _previousVertices.buffer(), *current = _currentVertices.buffer();
+		if (!first) {
+			for (size_t i = 0; i < n; i++)
+				previous[i] = current[i];
+		}
+		for (RenderCommand *command = _renderCommands; command; command = command->next) {
+			float *positions = command->positions;
+			for (int i = 0, nn = command->numVertices << 1; i < nn; i++)
+				*current++ = positions[i];
+		}
+		if (first) {
+			current = _currentVertices.buffer();
+			for (size_t i = 0; i < n; i++)
+				previous[i] = current[i];
+		}
+	}
+}
+
+void SkeletonWorldInstance::showPose() {
+	float alpha = _updateDelta > 0 ? _elapsed / _updateDelta : 1;
+	if (alpha > 1) alpha = 1;
+
+	Vector<Bone *> &bones = _skeleton->getBones();
+	if (_interpolateBones && _currentBones.size() == bones.size() * 6) {
+		const float *previous = _previousBones.buffer(), *current = _currentBones.buffer();
+		for (size_t i = 0, n = bones.size(); i < n; i++, previous += 6, current += 6) {
+			Bone *bone = bones[i];
+			bone->_a = previous[0] + (current[0] - previous[0]) * alpha;
+			bone->_b = previous[1] + (current[1] - previous[1]) * alpha;
+			bone->_c = previous[2] + (current[2] - previous[2]) * alpha;
+			bone->_d = previous[3] + (current[3] - previous[3]) * alpha;
+			bone->_worldX = previous[4] + (current[4] - previous[4]) * alpha;
+			bone->_worldY = previous[5] + (current[5] - previous[5]) * alpha;
+			bone->_modified = true;
+		}
+	}
+
+	if ((_interpolateVertices || _interpolateBones) && _renderCommands) {
+		const float *previous = _previousVertices.buffer(), *current = _currentVertices.buffer();
+		size_t n = _currentVertices.size();
+		for (RenderCommand *command = _renderCommands; command; command = command->next) {
+			int nn = command->numVertices << 1;
+			if ((size_t) nn > n) break;
+			float *positions = command->positions;
+			for (int i = 0; i < nn; i++)
+				positions[i] = previous[i] + (current[i] - previous[i]) * alpha;
+			previous += nn;
+			current += nn;
+			n -= nn;
+		}
+	}
+}
+
+SkeletonWorld::SkeletonWorld(TaskExecutor *executor) : _executor(executor), _ownsExecutor(executor == NULL),
+													   _physics(Physics_Update), _renderEnabled(false), _grainSize(4),
+													   _delta(0), _updateBudget(0), _updatedCount(0), _sharing(false) {
+	if (!_executor) _executor = new (__FILE__, __LINE__) WorkStealingPool();
+}
+
+SkeletonWorld::~SkeletonWorld() {
+	ContainerUtil::cleanUpVectorOfPointers(_instances);
+	if (_ownsExecutor) delete _executor;
+}
+
+SkeletonWorldInstance *SkeletonWorld::addInstance(SkeletonData *skeletonData, AnimationStateData *stateData) {
+	SkeletonWorldInstance *instance = new (__FILE__, __LINE__) SkeletonWorldInstance(skeletonData, stateData);
+	_instances.add(instance);
+	return instance;
+}
+
+void SkeletonWorld::removeInstance(SkeletonWorldInstance *instance) {
+	int index = _instances.indexOf(instance);
+	if (index == -1) return;
+	_instances.removeAt(index);
+	for (size_t i = 0, n = _instances.size(); i < n; i++)
+		if (_instances[i]->_source == instance) _instances[i]->_source = NULL;
+	delete instance;
+}
+
+Vector<SkeletonWorldInstance *> &SkeletonWorld::getInstances() {
+	return _instances;
+}
+
+void SkeletonWorld::update(float delta) {
+	_delta = delta;
+	_due.clear();
+	_shared.clear();
+	size_t unposed = 0;
+	for (size_t i = 0, n = _instances.size(); i < n; i++) {
+		SkeletonWorldInstance *instance = _instances[i];
+		instance->_updated = false;
+		if (!instance->_active) continue;
+		if (instance->_source != NULL) {
+			if (instance->_source->_active) _shared.add(instance);
+			continue;
+		}
+		instance->_pendingDelta += delta;
+		if (!instance->_posed) unposed++;
+		if (++instance->_skippedUpdates >= instance->_updateInterval || !instance->_posed) _due.add(instance);
+	}
+
+	size_t count = _due.size(), budget = MathUtil::max(_updateBudget, unposed);
+	if (_updateBudget > 0 && count > budget) {
+		_dueScores.setSize(count, 0);
+		for (size_t i = 0; i < count; i++)
+			_dueScores[i] = updateScore(_due[i]);
+		selectHighestScores(budget);
+		count = budget;
+	}
+	for (size_t i = 0; i < count; i++)
+		_due[i]->_updated = true;
+	_updatedCount = count;
+
+	_sharing = false;
+	_executor->execute(*this, _instances.size(), _grainSize);
+	if (_shared.size() > 0) {
+		_sharing = true;
+		_executor->execute(*this, _shared.size(), _grainSize);
+	}
+}
+
+void SkeletonWorld::run(size_t start, size_t end) {
+	if (_sharing) {
+		for (size_t i = start; i < end; i++) {
+			SkeletonWorldInstance *instance = _shared[i];
+			if (instance->_source->_posed) instance->share(_renderEnabled);
+		}
+		return;
+	}
+	for (size_t i = start; i < end; i++) {
+		SkeletonWorldInstance *instance = _instances[i];
+		if (!instance->_active || instance->_source != NULL) continue;
+		if (instance->_updated)
+			instance->update(_delta, _physics, _renderEnabled);
+		else if (instance->_posed)
+			instance->interpolate(_delta);
+	}
+}
+
+void SkeletonWorld::selectHighestScores(size_t n) {
+	SkeletonWorldInstance **due = _due.buffer();
+	float *scores = _dueScores.buffer();
+	// Partitions around a pivot, keeping the side that holds the nth highest score, until it is in place.
+	size_t nth = n - 1, low = 0, high = _due.size() - 1;
+	while (low < high) {
+		float pivot = scores[low + ((high - low) >> 1)];
+		size_t i = low, ii = high;
+		while (i <= ii) {
+			while (scores[i] > pivot) i++;
+			while (scores[ii] < pivot) ii--;
+			if (i > ii) break;
+			float score = scores[i];
+			scores[i] = scores[ii];
+			scores[ii] = score;
+			SkeletonWorldInstance *instance = due[i];
+			due[i] = due[ii];
+			due[ii] = instance;
+			i++;
+			if (ii == 0) break;
+			ii--;
+		}
+		if (nth <= ii)
+			high = ii;
+		else if (nth >= i)
+			low = i;
+		else
+			break;
+	}
+}
+
+float SkeletonWorld::updateScore(SkeletonWorldInstance *instance) {
+	if (!instance->_posed) return FLT_MAX;
+	return instance->_priority * instance->_skippedUpdates / instance->_updateInterval;
+}
+
+size_t SkeletonWorld::getUpdateBudget() {
+	return _updateBudget;
+}
+
+void SkeletonWorld::setUpdateBudget(size_t inValue) {
+	_updateBudget = inValue;
+}
+
+size_t SkeletonWorld::getUpdatedCount() {
+	return _updatedCount;
+}
+
+size_t SkeletonWorld::getSharedCount() {
+	return _shared.size();
+}
+
+SkeletonWorldInstance *
+SkeletonWorld::findNearestPhase(Vector<SkeletonWorldInstance *> &sources, float animationTime, size_t trackIndex) {
+	SkeletonWorldInstance *nearest = NULL;
+	float nearestDistance = FLT_MAX;
+	for (size_t i = 0, n = sources.size(); i < n; i++) {
+		TrackEntry *entry = sources[i]->_state->getCurrent(trackIndex);
+		if (entry == NULL) continue;
+		float distance = MathUtil::abs(entry->getAnimationTime() - animationTime);
+		if (entry->getLoop()) {
+			float duration = entry->getAnimationEnd() - entry->getAnimationStart();
+			if (duration > 0) {
+				distance = MathUtil::fmod(distance, duration);
+				distance = MathUtil::min(distance, duration - distance);
+			}
+		}
+		if (distance < nearestDistance) {
+			nearest = sources[i];
+			nearestDistance = distance;
+		}
+	}
+	return nearest;
+}
+
+TaskExecutor &SkeletonWorld::getExecutor() {
+	return *_executor;
+}
+
+Physics SkeletonWorld::getPhysics() {
+	return _physics;
+}
+
+void SkeletonWorld::setPhysics(Physics inValue) {
+	_physics = inValue;
+}
+
+bool SkeletonWorld::getRenderEnabled() {
+	return _renderEnabled;
+}
+
+void SkeletonWorld::setRenderEnabled(bool inValue) {
+	_renderEnabled = inValue;
+}
+
+size_t SkeletonWorld::getGrainSize() {
+	return _grainSize;
+}
+
+void SkeletonWorld::setGrainSize(size_t inValue) {
+	_grainSize = inValue;
+}
@@ -67,6 +67,10 @@ namespace spine {
 		return _frameEntries;
 	}
 
+	size_t Timeline::getMemorySize() {
+		return _frames.getCapacity() * sizeof(float) + _propertyIds.getCapacity() * sizeof(PropertyId);
+	}
+
 	float Timeline::getDuration() {
 		return _frames[_frames.size() - getFrameEntries()];
 	}
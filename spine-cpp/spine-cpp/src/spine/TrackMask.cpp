@@ -0,0 +1,123 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/TrackMask.h>
+
+#include <spine/BoneData.h>
+#include <spine/DeformTimeline.h>
+#include <spine/Property.h>
+#include <spine/SequenceTimeline.h>
+#include <spine/SkeletonData.h>
+#include <spine/SlotData.h>
+#include <spine/Timeline.h>
+
+using namespace spine;
+
+TrackMask::TrackMask(SkeletonData &skeletonData) : _skeletonData(skeletonData), _version(0) {
+	_boneWeights.setSize(skeletonData.getBones().size(), 1);
+	_slotWeights.setSize(skeletonData.getSlots().size(), 1);
+}
+
+float TrackMask::getBoneWeight(int boneIndex) {
+	return _boneWeights[boneIndex];
+}
+
+void TrackMask::setBoneWeight(int boneIndex, float weight, bool descendants) {
+	Vector<BoneData *> &bones = _skeletonData.getBones();
+	BoneData *bone = bones[boneIndex];
+	_boneWeights[boneIndex] = weight;
+	if (descendants) {
+		// Bones are sorted so parents come before their children.
+		for (size_t i = boneIndex + 1, n = bones.size(); i < n; i++) {
+			for (BoneData *parent = bones[i]->getParent(); parent != NULL; parent = parent->getParent()) {
+				if (parent == bone) {
+					_boneWeights[i] = weight;
+					break;
+				}
+			}
+		}
+	}
+	Vector<SlotData *> &slots = _skeletonData.getSlots();
+	for (size_t i = 0, n = slots.size(); i < n; i++) {
+		BoneData *slotBone = &slots[i]->getBoneData();
+		if (descendants)
+			while (slotBone != NULL && slotBone != bone) slotBone = slotBone->getParent();
+		if (slotBone == bone) _slotWeights[i] = weight;
+	}
+	_version++;
+}
+
+float TrackMask::getSlotWeight(int slotIndex) {
+	return _slotWeights[slotIndex];
+}
+
+void TrackMask::setSlotWeight(int slotIndex, float weight) {
+	_slotWeights[slotIndex] = weight;
+	_version++;
+}
+
+void TrackMask::setWeights(float weight) {
+	for (size_t i = 0, n = _boneWeights.size(); i < n; i++)
+		_boneWeights[i] = weight;
+	for (size_t i = 0, n = _slotWeights.size(); i < n; i++)
+		_slotWeights[i] = weight;
+	_version++;
+}
+
+float TrackMask::getTimelineWeight(Timeline &timeline) {
+	PropertyId id = timeline.getPropertyIds()[0];
+	unsigned int index = (unsigned int) (id & 0xffffffff);
+	switch ((int) (id >> 32)) {
+		case Property_Rotate:
+		case Property_X:
+		case Property_Y:
+		case Property_ScaleX:
+		case Property_ScaleY:
+		case Property_ShearX:
+		case Property_ShearY:
+		case Property_Inherit:
+			return _boneWeights[index];
+		case Property_Rgb:
+		case Property_Alpha:
+		case Property_Rgb2:
+		case Property_Attachment:
+			return _slotWeights[index];
+		// The ID also holds the attachment's ID, which is not limited to 16 bits.
+		case Property_Deform:
+			if (timeline.getRTTI().instanceOf(DeformTimeline::rtti))
+				return _slotWeights[static_cast<DeformTimeline &>(timeline).getSlotIndex()];
+			return 1;
+		case Property_Sequence:
+			if (timeline.getRTTI().instanceOf(SequenceTimeline::rtti))
+				return _slotWeights[static_cast<SequenceTimeline &>(timeline).getSlotIndex()];
+			return 1;
+		default:
+			return 1;
+	}
+}
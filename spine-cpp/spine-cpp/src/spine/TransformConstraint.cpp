@@ -41,8 +41,7 @@ RTTI_IMPL(TransformConstraint, Updatable)
 
 TransformConstraint::TransformConstraint(TransformConstraintData &data, Skeleton &skeleton) : Updatable(),
 																							  _data(data),
-																							  _target(skeleton.findBone(
-																									  data.getTarget()->getName())),
+																							  _target(skeleton.getBones()[data.getTarget()->getIndex()]),
 																							  _mixRotate(
 																									  data.getMixRotate()),
 																							  _mixX(data.getMixX()),
@@ -57,7 +56,7 @@ TransformConstraint::TransformConstraint(TransformConstraintData &data, Skeleton
 	_bones.ensureCapacity(_data.getBones().size());
 	for (size_t i = 0; i < _data.getBones().size(); ++i) {
 		BoneData *boneData = _data.getBones()[i];
-		_bones.add(skeleton.findBone(boneData->getName()));
+		_bones.add(skeleton.getBones()[boneData->getIndex()]);
 	}
 }
 
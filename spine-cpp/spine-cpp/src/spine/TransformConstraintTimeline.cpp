@@ -118,12 +118,14 @@ void TransformConstraintTimeline::apply(Skeleton &skeleton, float lastTime, floa
 			break;
 		}
 		default: {
-			rotate = getBezierValue(time, i, ROTATE, curveType - BEZIER);
-			x = getBezierValue(time, i, X, curveType + BEZIER_SIZE - BEZIER);
-			y = getBezierValue(time, i, Y, curveType + BEZIER_SIZE * 2 - BEZIER);
-			scaleX = getBezierValue(time, i, SCALEX, curveType + BEZIER_SIZE * 3 - BEZIER);
-			scaleY = getBezierValue(time, i, SCALEY, curveType + BEZIER_SIZE * 4 - BEZIER);
-			shearY = getBezierValue(time, i, SHEARY, curveType + BEZIER_SIZE * 5 - BEZIER);
+			float values[6];
+			getBezierValues(time, i, curveType - BEZIER, values, 6);
+			rotate = values[0];
+			x = values[1];
+			y = values[2];
+			scaleX = values[3];
+			scaleY = values[4];
+			shearY = values[5];
 		}
 	}
 
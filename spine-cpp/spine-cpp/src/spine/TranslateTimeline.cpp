@@ -60,6 +60,7 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 
 	Bone *bone = skeleton._bones[_boneIndex];
 	if (!bone->_active) return;
+	bone->_modified = true;
 
 	if (time < _frames[0]) {
 		switch (blend) {
@@ -95,9 +96,10 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 			break;
 		}
 		default: {
-			x = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline::BEZIER);
-			y = getBezierValue(time, i, CurveTimeline2::VALUE2,
-							   curveType + CurveTimeline::BEZIER_SIZE - CurveTimeline::BEZIER);
+			float values[2];
+			getBezierValues(time, i, curveType - CurveTimeline::BEZIER, values, 2);
+			x = values[0];
+			y = values[1];
 		}
 	}
 
@@ -136,7 +138,10 @@ void TranslateXTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	SP_UNUSED(direction);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_x = getRelativeValue(time, alpha, blend, bone->_x, bone->_data._x);
+	if (bone->_active) {
+		bone->_modified = true;
+		bone->_x = getRelativeValue(time, alpha, blend, bone->_x, bone->_data._x);
+	}
 }
 
 RTTI_IMPL(TranslateYTimeline, CurveTimeline1)
@@ -158,5 +163,8 @@ void TranslateYTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	SP_UNUSED(direction);
 
 	Bone *bone = skeleton._bones[_boneIndex];
-	if (bone->_active) bone->_y = getRelativeValue(time, alpha, blend, bone->_y, bone->_data._y);
+	if (bone->_active) {
+		bone->_modified = true;
+		bone->_y = getRelativeValue(time, alpha, blend, bone->_y, bone->_data._y);
+	}
 }
@@ -60,7 +60,9 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 
 void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t count, float *worldVertices, size_t offset,
 											size_t stride) {
-	count = offset + (count >> 1) * stride;
+	bool full = start == 0 && count == _worldVerticesLength;
+	size_t vertexCount = count >> 1;
+	count = offset + vertexCount * stride;
 	Skeleton &skeleton = slot._bone._skeleton;
 	Vector<float> *deformArray = &slot.getDeform();
 	Vector<float> *vertices = &_vertices;
@@ -69,18 +71,17 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 		if (deformArray->size() > 0) vertices = deformArray;
 
 		Bone &bone = slot._bone;
-		float x = bone._worldX;
-		float y = bone._worldY;
-		float a = bone._a, b = bone._b, c = bone._c, d = bone._d;
-		for (size_t vv = start, w = offset; w < count; vv += 2, w += stride) {
-			float vx = (*vertices)[vv];
-			float vy = (*vertices)[vv + 1];
-			worldVertices[w] = vx * a + vy * b + x;
-			worldVertices[w + 1] = vx * c + vy * d + y;
-		}
+		VertexSkinning::transform(vertices->buffer() + start, vertexCount, bone._a, bone._b, bone._c, bone._d,
+								  bone._worldX, bone._worldY, worldVertices + offset, stride);
 		return;
 	}
 
+	Vector<Bone *> &skeletonBones = skeleton.getBones();
+	if (full && _skinning.isBuilt(bones.size(), _vertices.size()) &&
+		_skinning.computeWorldVertices(skeletonBones, deformArray->size() > 0 ? deformArray->buffer() : NULL,
+									   worldVertices, offset, stride))
+		return;
+
 	int v = 0, skip = 0;
 	for (size_t i = 0; i < start; i += 2) {
 		int n = (int) bones[v];
@@ -88,7 +89,6 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 		skip += n;
 	}
 
-	Vector<Bone *> &skeletonBones = skeleton.getBones();
 	if (deformArray->size() == 0) {
 		for (size_t w = offset, b = skip * 3; w < count; w += stride) {
 			float wx = 0, wy = 0;
@@ -164,4 +164,9 @@ void VertexAttachment::copyTo(VertexAttachment *other) {
 	other->_vertices.clearAndAddAll(this->_vertices);
 	other->_worldVerticesLength = this->_worldVerticesLength;
 	other->_timelineAttachment = this->_timelineAttachment;
+	other->updateSkinning();
+}
+
+void VertexAttachment::updateSkinning() {
+	_skinning.build(_bones, _vertices);
 }
@@ -0,0 +1,370 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/VertexSkinning.h>
+
+#include <spine/Bone.h>
+
+#if defined(SPINE_NO_SIMD)
+#define SPINE_SKINNING_SCALAR
+#elif defined(__AVX2__)
+#define SPINE_SKINNING_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SPINE_SKINNING_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SPINE_SKINNING_NEON
+#include <arm_neon.h>
+#else
+#define SPINE_SKINNING_SCALAR
+#endif
+
+using namespace spine;
+
+/// Buckets are padded to this many vertices so every kernel processes whole blocks.
+static const int PADDING = 8;
+
+/// The bone matrices are gathered on the stack, attachments using more bones take the scalar path.
+static const size_t MAX_BONES = 256;
+
+/// Floats per gathered bone: a, b, c, d, worldX, worldY and 2 floats padding.
+static const int MATRIX_SIZE = 8;
+
+VertexSkinning::VertexSkinning() : _bonesCount(0), _verticesCount(0) {
+}
+
+VertexSkinning::~VertexSkinning() {
+}
+
+void VertexSkinning::clear() {
+	_buckets.clear();
+	_vertexIndices.clear();
+	_skinBones.clear();
+	_boneIndices.clear();
+	_deformOffsets.clear();
+	_x.clear();
+	_y.clear();
+	_weights.clear();
+	_bonesCount = 0;
+	_verticesCount = 0;
+}
+
+bool VertexSkinning::isBuilt(size_t bonesCount, size_t verticesCount) {
+	return _bonesCount > 0 && _bonesCount == bonesCount && _verticesCount == verticesCount;
+}
+
+void VertexSkinning::build(Vector<int> &bones, Vector<float> &vertices) {
+	clear();
+	if (bones.size() == 0) return;
+
+	// Count the vertices per influence count and map skeleton bone indices to indices into the gathered matrices.
+	Vector<int> counts, skinIndices;
+	for (size_t i = 0, n = bones.size(); i < n;) {
+		int influenceCount = bones[i++];
+		if ((int) counts.size() <= influenceCount) counts.setSize(influenceCount + 1, 0);
+		counts[influenceCount]++;
+		for (int ii = 0; ii < influenceCount; ii++) {
+			int boneIndex = bones[i++];
+			if ((int) skinIndices.size() <= boneIndex) skinIndices.setSize(boneIndex + 1, -1);
+			if (skinIndices[boneIndex] == -1) {
+				skinIndices[boneIndex] = (int) _skinBones.size();
+				_skinBones.add(boneIndex);
+			}
+		}
+	}
+
+	Vector<int> bucketIndices;
+	bucketIndices.setSize(counts.size(), -1);
+	int start = 0, vertexStart = 0;
+	for (size_t i = 0; i < counts.size(); i++) {
+		if (counts[i] == 0) continue;
+		Bucket bucket;
+		bucket.influenceCount = (int) i;
+		bucket.vertexCount = counts[i];
+		bucket.paddedCount = (counts[i] + PADDING - 1) / PADDING * PADDING;
+		bucket.vertexStart = vertexStart;
+		bucket.start = start;
+		bucketIndices[i] = (int) _buckets.size();
+		_buckets.add(bucket);
+		vertexStart += bucket.paddedCount;
+		start += bucket.influenceCount * bucket.paddedCount;
+	}
+
+	// Padding influences use the first bone and deform offset with a zero weight, their results are discarded.
+	_vertexIndices.setSize(vertexStart, -1);
+	_boneIndices.setSize(start, 0);
+	_deformOffsets.setSize(start, 0);
+	_x.setSize(start, 0);
+	_y.setSize(start, 0);
+	_weights.setSize(start, 0);
+
+	for (size_t i = 0; i < counts.size(); i++)
+		counts[i] = 0;
+	for (size_t i = 0, n = bones.size(), vertex = 0, b = 0; i < n; vertex++) {
+		int influenceCount = bones[i++];
+		Bucket &bucket = _buckets[bucketIndices[influenceCount]];
+		int v = counts[influenceCount]++;
+		_vertexIndices[bucket.vertexStart + v] = (int) vertex;
+		for (int ii = 0; ii < influenceCount; ii++, b++) {
+			int index = bucket.start + ii * bucket.paddedCount + v;
+			_boneIndices[index] = skinIndices[bones[i++]];
+			_deformOffsets[index] = (int) (b << 1);
+			_x[index] = vertices[b * 3];
+			_y[index] = vertices[b * 3 + 1];
+			_weights[index] = vertices[b * 3 + 2];
+		}
+	}
+
+	_bonesCount = bones.size();
+	_verticesCount = vertices.size();
+}
+
+bool VertexSkinning::computeWorldVertices(Vector<Bone *> &skeletonBones, float *deform, float *worldVertices,
+										  size_t offset, size_t stride) {
+	size_t bonesCount = _skinBones.size();
+	if (bonesCount > MAX_BONES) return false;
+
+	float matrices[MAX_BONES * MATRIX_SIZE];
+	for (size_t i = 0; i < bonesCount; i++) {
+		Bone &bone = *skeletonBones[_skinBones[i]];
+		float *m = matrices + i * MATRIX_SIZE;
+		m[0] = bone._a;
+		m[1] = bone._b;
+		m[2] = bone._c;
+		m[3] = bone._d;
+		m[4] = bone._worldX;
+		m[5] = bone._worldY;
+		m[6] = 0;
+		m[7] = 0;
+	}
+
+	const int *boneIndices = _boneIndices.buffer();
+	const int *deformOffsets = _deformOffsets.buffer();
+	const float *xs = _x.buffer(), *ys = _y.buffer(), *weights = _weights.buffer();
+	for (size_t i = 0; i < _buckets.size(); i++) {
+		Bucket &bucket = _buckets[i];
+		const int *vertexIndices = _vertexIndices.buffer() + bucket.vertexStart;
+#ifdef SPINE_SKINNING_SCALAR
+		for (int v = 0; v < bucket.vertexCount; v++) {
+			float wx = 0, wy = 0;
+			for (int ii = 0, index = bucket.start + v; ii < bucket.influenceCount; ii++, index += bucket.paddedCount) {
+				const float *m = matrices + boneIndices[index] * MATRIX_SIZE;
+				float vx = xs[index], vy = ys[index];
+				if (deform) {
+					vx += deform[deformOffsets[index]];
+					vy += deform[deformOffsets[index] + 1];
+				}
+				wx += (vx * m[0] + vy * m[1] + m[4]) * weights[index];
+				wy += (vx * m[2] + vy * m[3] + m[5]) * weights[index];
+			}
+			float *w = worldVertices + offset + vertexIndices[v] * stride;
+			w[0] = wx;
+			w[1] = wy;
+		}
+#else
+#ifdef SPINE_SKINNING_AVX2
+		const int width = 8;
+#else
+		const int width = 4;
+#endif
+		float outX[8], outY[8];
+		for (int v = 0; v < bucket.vertexCount; v += width) {
+#if defined(SPINE_SKINNING_AVX2)
+			__m256 wx = _mm256_setzero_ps(), wy = _mm256_setzero_ps();
+			for (int ii = 0, index = bucket.start + v; ii < bucket.influenceCount; ii++, index += bucket.paddedCount) {
+				__m256i bone = _mm256_slli_epi32(_mm256_loadu_si256((const __m256i *) (boneIndices + index)), 3);
+				__m256 vx = _mm256_loadu_ps(xs + index), vy = _mm256_loadu_ps(ys + index);
+				if (deform) {
+					__m256i f = _mm256_loadu_si256((const __m256i *) (deformOffsets + index));
+					vx = _mm256_add_ps(vx, _mm256_i32gather_ps(deform, f, 4));
+					vy = _mm256_add_ps(vy, _mm256_i32gather_ps(deform + 1, f, 4));
+				}
+				__m256 a = _mm256_i32gather_ps(matrices, bone, 4);
+				__m256 b = _mm256_i32gather_ps(matrices + 1, bone, 4);
+				__m256 c = _mm256_i32gather_ps(matrices + 2, bone, 4);
+				__m256 d = _mm256_i32gather_ps(matrices + 3, bone, 4);
+				__m256 x = _mm256_i32gather_ps(matrices + 4, bone, 4);
+				__m256 y = _mm256_i32gather_ps(matrices + 5, bone, 4);
+				__m256 weight = _mm256_loadu_ps(weights + index);
+				__m256 px = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, a), _mm256_mul_ps(vy, b)), x);
+				__m256 py = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, c), _mm256_mul_ps(vy, d)), y);
+				wx = _mm256_add_ps(wx, _mm256_mul_ps(px, weight));
+				wy = _mm256_add_ps(wy, _mm256_mul_ps(py, weight));
+			}
+			_mm256_storeu_ps(outX, wx);
+			_mm256_storeu_ps(outY, wy);
+#elif defined(SPINE_SKINNING_SSE2)
+			__m128 wx = _mm_setzero_ps(), wy = _mm_setzero_ps();
+			for (int ii = 0, index = bucket.start + v; ii < bucket.influenceCount; ii++, index += bucket.paddedCount) {
+				const float *m0 = matrices + boneIndices[index] * MATRIX_SIZE;
+				const float *m1 = matrices + boneIndices[index + 1] * MATRIX_SIZE;
+				const float *m2 = matrices + boneIndices[index + 2] * MATRIX_SIZE;
+				const float *m3 = matrices + boneIndices[index + 3] * MATRIX_SIZE;
+				__m128 a = _mm_loadu_ps(m0), b = _mm_loadu_ps(m1), c = _mm_loadu_ps(m2), d = _mm_loadu_ps(m3);
+				_MM_TRANSPOSE4_PS(a, b, c, d);
+				__m128 x = _mm_loadu_ps(m0 + 4), y = _mm_loadu_ps(m1 + 4), z = _mm_loadu_ps(m2 + 4), w = _mm_loadu_ps(m3 + 4);
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+				__m128 vx = _mm_loadu_ps(xs + index), vy = _mm_loadu_ps(ys + index);
+				if (deform) {
+					const int *f = deformOffsets + index;
+					vx = _mm_add_ps(vx, _mm_setr_ps(deform[f[0]], deform[f[1]], deform[f[2]], deform[f[3]]));
+					vy = _mm_add_ps(vy, _mm_setr_ps(deform[f[0] + 1], deform[f[1] + 1], deform[f[2] + 1], deform[f[3] + 1]));
+				}
+				__m128 weight = _mm_loadu_ps(weights + index);
+				__m128 px = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, a), _mm_mul_ps(vy, b)), x);
+				__m128 py = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, c), _mm_mul_ps(vy, d)), y);
+				wx = _mm_add_ps(wx, _mm_mul_ps(px, weight));
+				wy = _mm_add_ps(wy, _mm_mul_ps(py, weight));
+			}
+			_mm_storeu_ps(outX, wx);
+			_mm_storeu_ps(outY, wy);
+#elif defined(SPINE_SKINNING_NEON)
+			float32x4_t wx = vdupq_n_f32(0), wy = vdupq_n_f32(0);
+			for (int ii = 0, index = bucket.start + v; ii < bucket.influenceCount; ii++, index += bucket.paddedCount) {
+				const float *m0 = matrices + boneIndices[index] * MATRIX_SIZE;
+				const float *m1 = matrices + boneIndices[index + 1] * MATRIX_SIZE;
+				const float *m2 = matrices + boneIndices[index + 2] * MATRIX_SIZE;
+				const float *m3 = matrices + boneIndices[index + 3] * MATRIX_SIZE;
+				float32x4x2_t t01 = vtrnq_f32(vld1q_f32(m0), vld1q_f32(m1));
+				float32x4x2_t t23 = vtrnq_f32(vld1q_f32(m2), vld1q_f32(m3));
+				float32x4_t a = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+				float32x4_t b = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+				float32x4_t c = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+				float32x4_t d = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+				float32x2x2_t p01 = vtrn_f32(vld1_f32(m0 + 4), vld1_f32(m1 + 4));
+				float32x2x2_t p23 = vtrn_f32(vld1_f32(m2 + 4), vld1_f32(m3 + 4));
+				float32x4_t x = vcombine_f32(p01.val[0], p23.val[0]);
+				float32x4_t y = vcombine_f32(p01.val[1], p23.val[1]);
+				float32x4_t vx = vld1q_f32(xs + index), vy = vld1q_f32(ys + index);
+				if (deform) {
+					const int *f = deformOffsets + index;
+					float dx[4] = {deform[f[0]], deform[f[1]], deform[f[2]], deform[f[3]]};
+					float dy[4] = {deform[f[0] + 1], deform[f[1] + 1], deform[f[2] + 1], deform[f[3] + 1]};
+					vx = vaddq_f32(vx, vld1q_f32(dx));
+					vy = vaddq_f32(vy, vld1q_f32(dy));
+				}
+				float32x4_t weight = vld1q_f32(weights + index);
+				float32x4_t px = vaddq_f32(vaddq_f32(vmulq_f32(vx, a), vmulq_f32(vy, b)), x);
+				float32x4_t py = vaddq_f32(vaddq_f32(vmulq_f32(vx, c), vmulq_f32(vy, d)), y);
+				wx = vaddq_f32(wx, vmulq_f32(px, weight));
+				wy = vaddq_f32(wy, vmulq_f32(py, weight));
+			}
+			vst1q_f32(outX, wx);
+			vst1q_f32(outY, wy);
+#endif
+			int n = bucket.vertexCount - v < width ? bucket.vertexCount - v : width;
+			for (int ii = 0; ii < n; ii++) {
+				float *w = worldVertices + offset + vertexIndices[v + ii] * stride;
+				w[0] = outX[ii];
+				w[1] = outY[ii];
+			}
+		}
+#endif
+	}
+	return true;
+}
+
+void VertexSkinning::transform(const float *vertices, size_t vertexCount, float a, float b, float c, float d, float x,
+							   float y, float *worldVertices, size_t stride) {
+	size_t v = 0;
+#if defined(SPINE_SKINNING_AVX2) || defined(SPINE_SKINNING_SSE2)
+	__m128 ac = _mm_setr_ps(a, c, a, c), bd = _mm_setr_ps(b, d, b, d), xy = _mm_setr_ps(x, y, x, y);
+	for (; v + 2 <= vertexCount; v += 2, vertices += 4, worldVertices += stride << 1) {
+		__m128 p = _mm_loadu_ps(vertices);
+		__m128 px = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+		__m128 py = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+		__m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, ac), _mm_mul_ps(py, bd)), xy);
+		_mm_storel_pi((__m64 *) worldVertices, r);
+		_mm_storeh_pi((__m64 *) (worldVertices + stride), r);
+	}
+#elif defined(SPINE_SKINNING_NEON)
+	float32x4_t vx4 = vdupq_n_f32(x), vy4 = vdupq_n_f32(y);
+	for (; v + 4 <= vertexCount; v += 4, vertices += 8, worldVertices += stride << 2) {
+		float32x4x2_t p = vld2q_f32(vertices);
+		float32x4x2_t r;
+		r.val[0] = vaddq_f32(vaddq_f32(vmulq_n_f32(p.val[0], a), vmulq_n_f32(p.val[1], b)), vx4);
+		r.val[1] = vaddq_f32(vaddq_f32(vmulq_n_f32(p.val[0], c), vmulq_n_f32(p.val[1], d)), vy4);
+		if (stride == 2)
+			vst2q_f32(worldVertices, r);
+		else {
+			vst2q_lane_f32(worldVertices, r, 0);
+			vst2q_lane_f32(worldVertices + stride, r, 1);
+			vst2q_lane_f32(worldVertices + stride * 2, r, 2);
+			vst2q_lane_f32(worldVertices + stride * 3, r, 3);
+		}
+	}
+#endif
+	for (; v < vertexCount; v++, vertices += 2, worldVertices += stride) {
+		float vx = vertices[0], vy = vertices[1];
+		worldVertices[0] = vx * a + vy * b + x;
+		worldVertices[1] = vx * c + vy * d + y;
+	}
+}
+
+void VertexSkinning::transformRegion(const float *offsets, float a, float b, float c, float d, float x, float y,
+									 float *worldVertices, size_t stride) {
+#if defined(SPINE_SKINNING_AVX2) || defined(SPINE_SKINNING_SSE2)
+	__m128 ac = _mm_setr_ps(a, c, a, c), bd = _mm_setr_ps(b, d, b, d), xy = _mm_setr_ps(x, y, x, y);
+	__m128 p = _mm_loadu_ps(offsets);
+	__m128 blul = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0)), ac),
+										_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1)), bd)), xy);
+	p = _mm_loadu_ps(offsets + 4);
+	__m128 urbr = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0)), ac),
+										_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1)), bd)), xy);
+	_mm_storeh_pi((__m64 *) worldVertices, urbr);
+	_mm_storel_pi((__m64 *) (worldVertices + stride), blul);
+	_mm_storeh_pi((__m64 *) (worldVertices + stride * 2), blul);
+	_mm_storel_pi((__m64 *) (worldVertices + stride * 3), urbr);
+#elif defined(SPINE_SKINNING_NEON)
+	float32x4x2_t p = vld2q_f32(offsets);
+	float32x4x2_t r;
+	r.val[0] = vaddq_f32(vaddq_f32(vmulq_n_f32(p.val[0], a), vmulq_n_f32(p.val[1], b)), vdupq_n_f32(x));
+	r.val[1] = vaddq_f32(vaddq_f32(vmulq_n_f32(p.val[0], c), vmulq_n_f32(p.val[1], d)), vdupq_n_f32(y));
+	vst2q_lane_f32(worldVertices, r, 3);
+	vst2q_lane_f32(worldVertices + stride, r, 0);
+	vst2q_lane_f32(worldVertices + stride * 2, r, 1);
+	vst2q_lane_f32(worldVertices + stride * 3, r, 2);
+#else
+	transform(offsets + 6, 1, a, b, c, d, x, y, worldVertices, stride);
+	transform(offsets, 3, a, b, c, d, x, y, worldVertices + stride, stride);
+#endif
+}
+
+const char *VertexSkinning::getInstructionSet() {
+#if defined(SPINE_SKINNING_AVX2)
+	return "AVX2";
+#elif defined(SPINE_SKINNING_SSE2)
+	return "SSE2";
+#elif defined(SPINE_SKINNING_NEON)
+	return "NEON";
+#else
+	return "scalar";
+#endif
+}
@@ -0,0 +1,236 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/WorkStealingPool.h>
+
+#include <spine/Extension.h>
+
+#include <assert.h>
+#include <stdint.h>
+
+#ifndef SPINE_NO_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+using namespace spine;
+
+static void runSerial(Task &task, size_t count, size_t grainSize) {
+	for (size_t start = 0; start < count; start += grainSize)
+		task.run(start, count - start < grainSize ? count : start + grainSize);
+}
+
+#ifdef SPINE_NO_THREADS
+
+struct WorkStealingPool::State : public SpineObject {
+};
+
+WorkStealingPool::WorkStealingPool(int threadCount) : _state(NULL) {
+	SP_UNUSED(threadCount);
+}
+
+WorkStealingPool::~WorkStealingPool() {
+}
+
+void WorkStealingPool::execute(Task &task, size_t count, size_t grainSize) {
+	runSerial(task, count, grainSize > 0 ? grainSize : 1);
+}
+
+int WorkStealingPool::getThreadCount() {
+	return 1;
+}
+
+#else
+
+namespace {
+	/// The remaining items of one thread's share, start in the high and end in the low 32 bits so the owner and thieves
+	/// can both update it with a single compare and swap. Padded to its own cache line.
+	struct Share : public SpineObject {
+		std::atomic<uint64_t> range;
+		char padding[64 - sizeof(std::atomic<uint64_t>)];
+
+		Share() : range(0) {
+		}
+	};
+
+	struct Worker : public SpineObject {
+		std::thread thread;
+	};
+
+	inline uint64_t pack(size_t start, size_t end) {
+		return ((uint64_t) start << 32) | (uint64_t) end;
+	}
+
+	/// Takes up to grainSize items from the front of a share.
+	bool take(std::atomic<uint64_t> &range, size_t grainSize, size_t &start, size_t &end) {
+		uint64_t value = range.load();
+		for (;;) {
+			size_t first = (size_t) (value >> 32), last = (size_t) (value & 0xffffffff);
+			if (first >= last) return false;
+			size_t next = last - first > grainSize ? first + grainSize : last;
+			if (range.compare_exchange_weak(value, pack(next, last))) {
+				start = first;
+				end = next;
+				return true;
+			}
+		}
+	}
+
+	/// Takes half of the items from the back of a share, or all of them if they fit in one grain.
+	bool steal(std::atomic<uint64_t> &range, size_t grainSize, size_t &start, size_t &end) {
+		uint64_t value = range.load();
+		for (;;) {
+			size_t first = (size_t) (value >> 32), last = (size_t) (value & 0xffffffff);
+			if (first >= last) return false;
+			size_t split = last - first > grainSize ? last - (last - first) / 2 : first;
+			if (range.compare_exchange_weak(value, pack(first, split))) {
+				start = split;
+				end = last;
+				return true;
+			}
+		}
+	}
+}
+
+struct WorkStealingPool::State : public SpineObject {
+	Vector<Share *> shares;
+	Vector<Worker *> workers;
+	std::mutex mutex;
+	std::condition_variable started, finished;
+	Task *task;
+	size_t grainSize;
+	unsigned int generation;
+	int busy;
+	bool stop;
+
+	State() : task(NULL), grainSize(1), generation(0), busy(0), stop(false) {
+	}
+
+	/// Runs items from the share at index until no share has items left.
+	void run(size_t index) {
+		size_t count = shares.size(), start, end;
+		std::atomic<uint64_t> &own = shares[index]->range;
+		for (;;) {
+			if (take(own, grainSize, start, end)) {
+				task->run(start, end);
+				continue;
+			}
+			bool stolen = false;
+			for (size_t i = 1; i < count; i++) {
+				if (steal(shares[(index + i) % count]->range, grainSize, start, end)) {
+					own.store(pack(start, end));
+					stolen = true;
+					break;
+				}
+			}
+			if (!stolen) return;
+		}
+	}
+
+	static void main(State *state, size_t index) {
+		unsigned int generation = 0;
+		for (;;) {
+			{
+				std::unique_lock<std::mutex> lock(state->mutex);
+				while (!state->stop && state->generation == generation)
+					state->started.wait(lock);
+				if (state->stop) return;
+				generation = state->generation;
+			}
+			state->run(index);
+			{
+				std::lock_guard<std::mutex> lock(state->mutex);
+				if (--state->busy == 0) state->finished.notify_one();
+			}
+		}
+	}
+};
+
+WorkStealingPool::WorkStealingPool(int threadCount) : _state(new (__FILE__, __LINE__) State()) {
+	if (threadCount <= 0) threadCount = (int) std::thread::hardware_concurrency();
+	if (threadCount <= 0) threadCount = 1;
+	for (int i = 0; i < threadCount; i++)
+		_state->shares.add(new (__FILE__, __LINE__) Share());
+	for (int i = 1; i < threadCount; i++) {
+		Worker *worker = new (__FILE__, __LINE__) Worker();
+		worker->thread = std::thread(State::main, _state, (size_t) i);
+		_state->workers.add(worker);
+	}
+}
+
+WorkStealingPool::~WorkStealingPool() {
+	{
+		std::lock_guard<std::mutex> lock(_state->mutex);
+		_state->stop = true;
+	}
+	_state->started.notify_all();
+	for (size_t i = 0; i < _state->workers.size(); i++) {
+		_state->workers[i]->thread.join();
+		delete _state->workers[i];
+	}
+	for (size_t i = 0; i < _state->shares.size(); i++)
+		delete _state->shares[i];
+	delete _state;
+}
+
+void WorkStealingPool::execute(Task &task, size_t count, size_t grainSize) {
+	if (grainSize == 0) grainSize = 1;
+	size_t threadCount = _state->shares.size();
+	if (threadCount == 1 || count <= grainSize) {
+		runSerial(task, count, grainSize);
+		return;
+	}
+	assert(count <= 0xffffffff);
+
+	for (size_t i = 0; i < threadCount; i++)
+		_state->shares[i]->range.store(pack(count * i / threadCount, count * (i + 1) / threadCount));
+	{
+		std::lock_guard<std::mutex> lock(_state->mutex);
+		_state->task = &task;
+		_state->grainSize = grainSize;
+		_state->busy = (int) threadCount - 1;
+		_state->generation++;
+	}
+	_state->started.notify_all();
+
+	_state->run(0);
+
+	// Workers finish only after running what they took, so all items completed once every worker is done.
+	std::unique_lock<std::mutex> lock(_state->mutex);
+	while (_state->busy > 0)
+		_state->finished.wait(lock);
+}
+
+int WorkStealingPool::getThreadCount() {
+	return (int) _state->shares.size();
+}
+
+#endif
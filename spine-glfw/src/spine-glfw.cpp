@@ -1,5 +1,6 @@
 #include "spine-glfw.h"
 #include <cstdio>
+#include <cstddef>
 #include <glbinding/gl/gl.h>
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
@@ -272,8 +273,10 @@ renderer_t *renderer_create() {
 	auto *renderer = (renderer_t *) malloc(sizeof(renderer_t));
 	renderer->shader = shader;
 	renderer->mesh = mesh;
-	renderer->vertex_buffer_size = 0;
-	renderer->vertex_buffer = nullptr;
+	renderer->vertex_buffer_size = 8192;
+	renderer->vertex_buffer = (vertex_t *) malloc(sizeof(vertex_t) * renderer->vertex_buffer_size);
+	renderer->index_buffer_size = renderer->vertex_buffer_size * 3;
+	renderer->index_buffer = (uint16_t *) malloc(sizeof(uint16_t) * renderer->index_buffer_size);
 	renderer->renderer = new SkeletonRenderer();
 	return renderer;
 }
@@ -289,53 +292,64 @@ void renderer_draw_lite(renderer_t *renderer, spine_skeleton skeleton, bool prem
 	renderer_draw(renderer, (Skeleton *) skeleton, premultipliedAlpha);
 }
 
-void renderer_draw(renderer_t *renderer, Skeleton *skeleton, bool premultipliedAlpha) {
-	shader_use(renderer->shader);
-	shader_set_int(renderer->shader, "uTexture", 0);
-	glEnable(GL_BLEND);
+/// Uploads and draws each batch the skeleton renderer writes into the renderer's vertex and index buffer.
+struct renderer_buffer_t : public RenderBuffer {
+	renderer_t *renderer;
+	bool premultipliedAlpha;
 
-	RenderCommand *command = renderer->renderer->render(*skeleton);
-	while (command) {
-		int num_command_vertices = command->numVertices;
-		if (renderer->vertex_buffer_size < num_command_vertices) {
-			renderer->vertex_buffer_size = num_command_vertices;
-			free(renderer->vertex_buffer);
-			renderer->vertex_buffer = (vertex_t *) malloc(sizeof(vertex_t) * renderer->vertex_buffer_size);
-		}
-		float *positions = command->positions;
-		float *uvs = command->uvs;
-		uint32_t *colors = command->colors;
-		uint32_t *darkColors = command->darkColors;
-		for (int i = 0, j = 0; i < num_command_vertices; i++, j += 2) {
-			vertex_t *vertex = &renderer->vertex_buffer[i];
-			vertex->x = positions[j];
-			vertex->y = positions[j + 1];
-			vertex->u = uvs[j];
-			vertex->v = uvs[j + 1];
-			uint32_t color = colors[i];
-			vertex->color = (color & 0xFF00FF00) | ((color & 0x00FF0000) >> 16) | ((color & 0x000000FF) << 16);
-			uint32_t darkColor = darkColors[i];
-			vertex->darkColor = (darkColor & 0xFF00FF00) | ((darkColor & 0x00FF0000) >> 16) | ((darkColor & 0x000000FF) << 16);
-		}
-		int num_command_indices = command->numIndices;
-		uint16_t *indices = command->indices;
-		mesh_update(renderer->mesh, renderer->vertex_buffer, num_command_vertices, indices, num_command_indices);
-
-		blend_mode_t blend_mode = blend_modes[command->blendMode];
+	void setBuffers() {
+		VertexLayout layout(sizeof(vertex_t), offsetof(vertex_t, x), offsetof(vertex_t, u), offsetof(vertex_t, color), offsetof(vertex_t, darkColor),
+							VertexUVFormat_Float, VertexColorFormat_ABGR);
+		setVertices(renderer->vertex_buffer, layout, renderer->vertex_buffer_size);
+		setIndices(renderer->index_buffer, renderer->index_buffer_size);
+	}
+
+	void draw(RenderCommand &batch, int firstVertex, int firstIndex) override {
+		mesh_update(renderer->mesh, renderer->vertex_buffer + firstVertex, batch.numVertices, renderer->index_buffer + firstIndex, batch.numIndices);
+
+		blend_mode_t blend_mode = blend_modes[batch.blendMode];
 		glBlendFuncSeparate(premultipliedAlpha ? (GLenum) blend_mode.source_color_pma : (GLenum) blend_mode.source_color, (GLenum) blend_mode.dest_color, (GLenum) blend_mode.source_alpha, (GLenum) blend_mode.dest_color);
 
-		auto texture = (texture_t) (uintptr_t) command->texture;
+		auto texture = (texture_t) (uintptr_t) batch.texture;
 		texture_use(texture);
 
 		mesh_draw(renderer->mesh);
-		command = command->next;
 	}
+
+	void flush(int numVertices, int numIndices) override {
+		// All batches were uploaded in draw(), so the buffers can be replaced. Grow them until the attachment fits, so later
+		// frames fit without flushing.
+		do {
+			renderer->vertex_buffer_size *= 2;
+		} while (renderer->vertex_buffer_size < numVertices);
+		free(renderer->vertex_buffer);
+		renderer->vertex_buffer = (vertex_t *) malloc(sizeof(vertex_t) * renderer->vertex_buffer_size);
+		do {
+			renderer->index_buffer_size *= 2;
+		} while (renderer->index_buffer_size < numIndices);
+		free(renderer->index_buffer);
+		renderer->index_buffer = (uint16_t *) malloc(sizeof(uint16_t) * renderer->index_buffer_size);
+		setBuffers();
+	}
+};
+
+void renderer_draw(renderer_t *renderer, Skeleton *skeleton, bool premultipliedAlpha) {
+	shader_use(renderer->shader);
+	shader_set_int(renderer->shader, "uTexture", 0);
+	glEnable(GL_BLEND);
+
+	renderer_buffer_t buffer;
+	buffer.renderer = renderer;
+	buffer.premultipliedAlpha = premultipliedAlpha;
+	buffer.setBuffers();
+	renderer->renderer->render(*skeleton, buffer);
 }
 
 void renderer_dispose(renderer_t *renderer) {
 	shader_dispose(renderer->shader);
 	mesh_dispose(renderer->mesh);
 	free(renderer->vertex_buffer);
+	free(renderer->index_buffer);
 	delete renderer->renderer;
 	free(renderer);
 }
\ No newline at end of file
@@ -68,12 +68,15 @@ public:
 };
 
 /// Renderer capable of rendering a spine_skeleton_drawable, using a shader, a mesh, and a
-/// temporary CPU-side vertex buffer used to update the GPU-side mesh
+/// temporary CPU-side vertex and index buffer the skeleton renderer writes vertex_t vertices into directly. The
+/// buffers grow when a skeleton does not fit, which costs an extra flush for that frame only.
 typedef struct {
 	shader_t shader;
 	mesh_t *mesh;
 	int vertex_buffer_size;
 	vertex_t *vertex_buffer;
+	int index_buffer_size;
+	uint16_t *index_buffer;
 	spine::SkeletonRenderer *renderer;
 } renderer_t;
 
@@ -0,0 +1,123 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/Debug.h>
+#include <spine/spine.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace spine;
+
+SpineExtension *spine::getDefaultExtension() {
+	return new DefaultSpineExtension();
+}
+
+class NullTextureLoader : public TextureLoader {
+public:
+	virtual void load(AtlasPage &, const String &) {}
+
+	virtual void unload(void *) {}
+};
+
+DebugExtension dbgExtension(SpineExtension::getInstance());
+
+static const int warmupFrames = 3000;
+static const int frames = 3000;
+static const int tracks = 4;
+
+/**
+ * Randomly sets, queues, empties and clears animations on several tracks. After the warm-up, allocations are disallowed
+ * and the frames must run without allocating. At most one entry is queued per track, so this covers the track changes a
+ * warmed up entry pool can serve, not arbitrarily long queues, which may still grow the pool.
+ */
+bool testcase(const char *skeletonFile, const char *atlasFile) {
+	NullTextureLoader textureLoader;
+	Atlas atlas(atlasFile, &textureLoader);
+	SkeletonBinary binary(&atlas);
+	SkeletonData *skeletonData = binary.readSkeletonDataFile(skeletonFile);
+	if (!skeletonData) {
+		printf("%s: %s\n", skeletonFile, binary.getError().buffer());
+		return false;
+	}
+
+	AnimationStateData stateData(skeletonData);
+	stateData.setDefaultMix(0.2f);
+	Skeleton skeleton(skeletonData);
+	AnimationState state(&stateData);
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+
+	srand(1);
+	size_t before = dbgExtension.getDisallowedAllocations();
+	for (int i = 0; i < warmupFrames + frames; i++) {
+		if (i == warmupFrames) dbgExtension.setAllocationsAllowed(false);
+		size_t track = rand() % tracks;
+		Animation *animation = animations[rand() % animations.size()];
+		TrackEntry *current = state.getCurrent(track);
+		switch (rand() % 10) {
+			case 0:
+				state.setAnimation(track, animation, rand() % 2 == 0);
+				break;
+			case 1:
+				// Limit queued entries so the pool does not need to grow.
+				if (current == NULL || current->getNext() == NULL) state.addAnimation(track, animation, rand() % 2 == 0, 0.1f);
+				break;
+			case 2:
+				state.setEmptyAnimation(track, 0.1f);
+				break;
+			case 3:
+				if (rand() % 5 == 0) state.clearTrack(track);
+				break;
+			default:
+				break;
+		}
+		state.update(1 / 30.0f);
+		state.apply(skeleton);
+		skeleton.update(1 / 30.0f);
+		skeleton.updateWorldTransform(Physics_Update);
+	}
+	dbgExtension.setAllocationsAllowed(true);
+
+	size_t disallowed = dbgExtension.getDisallowedAllocations() - before;
+	printf("%s: %d disallowed allocations\n", skeletonFile, (int) disallowed);
+	delete skeletonData;
+	return disallowed == 0;
+}
+
+int main() {
+	SpineExtension::setInstance(&dbgExtension);
+
+	bool passed = true;
+	passed &= testcase("data/spineboy-pro.skel", "data/spineboy-pma.atlas");
+	passed &= testcase("data/raptor-pro.skel", "data/raptor-pma.atlas");
+	passed &= testcase("data/mix-and-match-pro.skel", "data/mix-and-match-pma.atlas");
+	passed &= testcase("data/celestial-circus-pro.skel", "data/celestial-circus-pma.atlas");
+
+	dbgExtension.reportLeaks();
+	return passed ? 0 : 1;
+}
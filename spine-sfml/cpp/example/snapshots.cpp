@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/Snapshot.h>
+#include <spine/spine.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace spine;
+
+SpineExtension *spine::getDefaultExtension() {
+	return new DefaultSpineExtension();
+}
+
+class NullTextureLoader : public TextureLoader {
+public:
+	virtual void load(AtlasPage &, const String &) {}
+
+	virtual void unload(void *) {}
+};
+
+/// Returns a copy of the snapshot whose header claims the given size, as if the buffer was cut off.
+static Vector<char> truncate(Vector<char> &snapshot, size_t size) {
+	Vector<char> truncated;
+	truncated.addAll(snapshot);
+	SnapshotHeader header;
+	memcpy(&header, truncated.buffer(), sizeof(SnapshotHeader));
+	header.size = (uint32_t) size;
+	memcpy(truncated.buffer(), &header, sizeof(SnapshotHeader));
+	return truncated;
+}
+
+static bool equals(Vector<char> &a, Vector<char> &b) {
+	return a.size() == b.size() && memcmp(a.buffer(), b.buffer(), a.size()) == 0;
+}
+
+/**
+ * Reads every truncation of a skeleton and an animation state snapshot. Each read must fail and leave the target unchanged,
+ * and applying the animation state afterwards must not crash. Reading the whole snapshot must succeed.
+ */
+bool testcase(const char *skeletonFile, const char *atlasFile) {
+	NullTextureLoader textureLoader;
+	Atlas atlas(atlasFile, &textureLoader);
+	SkeletonBinary binary(&atlas);
+	SkeletonData *skeletonData = binary.readSkeletonDataFile(skeletonFile);
+	if (!skeletonData) {
+		printf("%s: %s\n", skeletonFile, binary.getError().buffer());
+		return false;
+	}
+
+	AnimationStateData stateData(skeletonData);
+	stateData.setDefaultMix(0.2f);
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	Skeleton skeleton(skeletonData), target(skeletonData);
+	AnimationState state(&stateData), targetState(&stateData);
+	state.setAnimation(0, animations[0], true);
+	state.update(0.1f);
+	state.setAnimation(0, animations[animations.size() - 1], true);
+	state.addAnimation(0, animations[0], false, 0.5f);
+	state.setAnimation(1, animations[animations.size() / 2], true)->setAlpha(0.5f);
+	state.update(0.05f);
+	state.apply(skeleton);
+	skeleton.updateWorldTransform(Physics_Update);
+	targetState.setAnimation(0, animations[animations.size() / 2], false);
+
+	Vector<char> skeletonSnapshot, stateSnapshot, targetSnapshot, targetStateSnapshot, after;
+	skeletonSnapshot.setSize(skeleton.getSnapshotSize(), 0);
+	skeleton.writeSnapshot(skeletonSnapshot.buffer(), skeletonSnapshot.size());
+	stateSnapshot.setSize(state.getSnapshotSize(), 0);
+	state.writeSnapshot(stateSnapshot.buffer(), stateSnapshot.size());
+	targetSnapshot.setSize(target.getSnapshotSize(), 0);
+	target.writeSnapshot(targetSnapshot.buffer(), targetSnapshot.size());
+	targetStateSnapshot.setSize(targetState.getSnapshotSize(), 0);
+	targetState.writeSnapshot(targetStateSnapshot.buffer(), targetStateSnapshot.size());
+
+	int errors = 0;
+	for (size_t size = sizeof(SnapshotHeader); size < skeletonSnapshot.size(); size++) {
+		Vector<char> truncated = truncate(skeletonSnapshot, size);
+		if (target.readSnapshot(truncated.buffer(), truncated.size())) errors++;
+		after.setSize(target.getSnapshotSize(), 0);
+		target.writeSnapshot(after.buffer(), after.size());
+		if (!equals(after, targetSnapshot)) errors++;
+	}
+	for (size_t size = sizeof(SnapshotHeader); size < stateSnapshot.size(); size++) {
+		Vector<char> truncated = truncate(stateSnapshot, size);
+		if (targetState.readSnapshot(truncated.buffer(), truncated.size())) errors++;
+		after.setSize(targetState.getSnapshotSize(), 0);
+		targetState.writeSnapshot(after.buffer(), after.size());
+		if (!equals(after, targetStateSnapshot)) errors++;
+		// Applying must not crash. It changes the state, so the expected snapshot is written again.
+		targetState.apply(target);
+		targetStateSnapshot.setSize(targetState.getSnapshotSize(), 0);
+		targetState.writeSnapshot(targetStateSnapshot.buffer(), targetStateSnapshot.size());
+	}
+
+	if (!target.readSnapshot(skeletonSnapshot.buffer(), skeletonSnapshot.size())) errors++;
+	if (!targetState.readSnapshot(stateSnapshot.buffer(), stateSnapshot.size())) errors++;
+	after.setSize(targetState.getSnapshotSize(), 0);
+	targetState.writeSnapshot(after.buffer(), after.size());
+	if (!equals(after, stateSnapshot)) errors++;
+	targetState.update(0.05f);
+	targetState.apply(target);
+	target.updateWorldTransform(Physics_Update);
+
+	printf("%s: %d errors\n", skeletonFile, errors);
+	delete skeletonData;
+	return errors == 0;
+}
+
+int main() {
+	bool passed = true;
+	passed &= testcase("data/spineboy-pro.skel", "data/spineboy-pma.atlas");
+	passed &= testcase("data/mix-and-match-pro.skel", "data/mix-and-match-pma.atlas");
+	passed &= testcase("data/celestial-circus-pro.skel", "data/celestial-circus-pma.atlas");
+	return passed ? 0 : 1;
+}
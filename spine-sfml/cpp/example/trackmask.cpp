@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SequenceTimeline.h>
+#include <spine/spine.h>
+#include <stdio.h>
+
+using namespace spine;
+
+SpineExtension *spine::getDefaultExtension() {
+	return new DefaultSpineExtension();
+}
+
+class NullTextureLoader : public TextureLoader {
+public:
+	virtual void load(AtlasPage &, const String &) {}
+
+	virtual void unload(void *) {}
+};
+
+/**
+ * Masks each slot in turn and checks the weight TrackMask returns for every deform and sequence timeline. The property IDs
+ * of these timelines also hold the attachment ID, so the attachments are created with IDs beyond 16 bits.
+ */
+bool testcase(const char *skeletonFile, const char *atlasFile) {
+	NullTextureLoader textureLoader;
+	Atlas atlas(atlasFile, &textureLoader);
+	SkeletonBinary binary(&atlas);
+	SkeletonData *skeletonData = binary.readSkeletonDataFile(skeletonFile);
+	if (!skeletonData) {
+		printf("%s: %s\n", skeletonFile, binary.getError().buffer());
+		return false;
+	}
+
+	Vector<Timeline *> timelines;
+	Vector<int> slotIndices;
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		Vector<Timeline *> &animationTimelines = animations[i]->getTimelines();
+		for (size_t ii = 0; ii < animationTimelines.size(); ii++) {
+			Timeline *timeline = animationTimelines[ii];
+			if (timeline->getRTTI().instanceOf(DeformTimeline::rtti)) {
+				DeformTimeline *deform = static_cast<DeformTimeline *>(timeline);
+				if (deform->getAttachment()->getId() < 65536) {
+					printf("%s: attachment ID %d is below 65536\n", skeletonFile, deform->getAttachment()->getId());
+					delete skeletonData;
+					return false;
+				}
+				timelines.add(timeline);
+				slotIndices.add(deform->getSlotIndex());
+			} else if (timeline->getRTTI().instanceOf(SequenceTimeline::rtti)) {
+				timelines.add(timeline);
+				slotIndices.add(static_cast<SequenceTimeline *>(timeline)->getSlotIndex());
+			}
+		}
+	}
+
+	TrackMask mask(*skeletonData);
+	int errors = 0;
+	for (int slot = 0; slot < (int) skeletonData->getSlots().size(); slot++) {
+		mask.setWeights(0);
+		mask.setSlotWeight(slot, 1);
+		for (size_t i = 0; i < timelines.size(); i++) {
+			float expected = slotIndices[i] == slot ? 1 : 0;
+			if (mask.getTimelineWeight(*timelines[i]) != expected) errors++;
+		}
+	}
+
+	printf("%s: %d timelines, %d errors\n", skeletonFile, (int) timelines.size(), errors);
+	delete skeletonData;
+	return errors == 0;
+}
+
+int main() {
+	// Moves the attachment IDs past 16 bits.
+	while (true) {
+		MeshAttachment mesh("mesh");
+		if (mesh.getId() >= 65536) break;
+	}
+
+	bool passed = true;
+	passed &= testcase("data/spineboy-pro.skel", "data/spineboy-pma.atlas");
+	passed &= testcase("data/goblins-pro.skel", "data/goblins-pma.atlas");
+	passed &= testcase("data/owl-pro.skel", "data/owl-pma.atlas");
+	passed &= testcase("data/dragon-ess.skel", "data/dragon-pma.atlas");
+	return passed ? 0 : 1;
+}